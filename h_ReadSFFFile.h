@@ -10,7 +10,39 @@
 #include <system_error>  // std::error_codê
 #include <array>		 // Œẑ
 #include <vector>		 // ϒẑ
+#include <deque>		 // 񏈗̑҂s
+#include <iterator>		 // Ce[^̂
 #include <unordered_map> // nbVIȂ
+#include <algorithm>	 // std::minƂ̂
+#include <atomic>		 // std::atomiĉ
+#include <thread>		 // 񏈗p
+#include <mutex>		 // std::mutex̂
+#include <condition_variable> // 񓯊ǂݍ݂̊҂
+#include <functional>	 // std::function̂
+#include <memory>		 // std::shared_ptr̂
+#include <memory_resource> // std::pmr::memory_resourcê
+#include <exception>	 // std::exception_ptr̂
+#include <charconv>		 // std::from_charŝ
+
+// AVX2Lȃrhł̓pbgWJɃMU[߂gp
+#if defined(__AVX2__)
+#include <immintrin.h>	 // _mm256_i32gather_epi32̂
+#endif
+
+// SAELIB_SFF_SHARED_MEMORY`ĂCN[hꍇ̂݋L@\gpł
+#ifdef SAELIB_SFF_SHARED_MEMORY
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>	 // CreateFileMappinĝ
+#else
+#include <sys/mman.h>	 // shm_open/mmap̂
+#include <sys/stat.h>	 // fstat̂
+#include <fcntl.h>		 // O_CREATƂ̂
+#include <unistd.h>		 // ftruncate/closê
+#endif
+#endif
 
 namespace SAELib {
 	namespace ReadSffFile_detail {
@@ -36,6 +68,16 @@ namespace SAELib {
 			inline constexpr ksize_t kFileSizeLimit = 0xffffffff;
 		}
 
+		namespace AIRFormat {
+			inline constexpr std::string_view kExtension = ".air";
+			inline constexpr std::string_view kBeginAction = "begin action";
+			inline constexpr std::string_view kLoopStart = "loopstart";
+			inline constexpr std::string_view kClsn = "clsn";
+			inline constexpr std::string_view kInterpolate = "interpolate";
+			inline constexpr char kComment = ';';
+			inline constexpr int32_t kNumFrameField = 5; // O[vԍ, C[Wԍ, ItZbgX, ItZbgY, \
+		}
+
 		namespace DecodeBinary {
 			[[nodiscard]] inline constexpr uint16_t UInt16LE(const unsigned char* const buffer) noexcept {
 				return buffer[0] | (buffer[1] << 8);
@@ -49,6 +91,48 @@ namespace SAELib {
 			[[nodiscard]] inline constexpr uint32_t UInt32BE(const unsigned char* const buffer) noexcept { //igpj
 				return buffer[3] | (buffer[2] << 8) | (buffer[1] << 16) | (buffer[0] << 24);
 			}
+			[[nodiscard]] inline constexpr uint64_t UInt64LE(const unsigned char* const buffer) noexcept {
+				return static_cast<uint64_t>(UInt32LE(buffer)) | (static_cast<uint64_t>(UInt32LE(buffer + 4)) << 32);
+			}
+		}
+
+		namespace EncodeBinary {
+			inline void UInt16LE(unsigned char* const buffer, uint16_t value) noexcept {
+				buffer[0] = value & 0xFF;
+				buffer[1] = (value >> 8) & 0xFF;
+			}
+			inline void UInt32LE(unsigned char* const buffer, uint32_t value) noexcept {
+				buffer[0] = value & 0xFF;
+				buffer[1] = (value >> 8) & 0xFF;
+				buffer[2] = (value >> 16) & 0xFF;
+				buffer[3] = (value >> 24) & 0xFF;
+			}
+			inline void UInt32BE(unsigned char* const buffer, uint32_t value) noexcept {
+				buffer[0] = (value >> 24) & 0xFF;
+				buffer[1] = (value >> 16) & 0xFF;
+				buffer[2] = (value >> 8) & 0xFF;
+				buffer[3] = value & 0xFF;
+			}
+			inline void UInt64LE(unsigned char* const buffer, uint64_t value) noexcept {
+				UInt32LE(buffer, static_cast<uint32_t>(value));
+				UInt32LE(buffer + 4, static_cast<uint32_t>(value >> 32));
+			}
+		}
+
+		namespace HashBinary {
+			// FNV-1a8BytePʂœKp([1ByteP)
+			// 8Byte̓gGfBAƂēǂ݁AJ^OɕۑnbVls̃GfBAɈˑȂ悤ɂ
+			[[nodiscard]] inline uint64_t FNV1a64(const unsigned char* const Data, size_t Size) noexcept {
+				uint64_t Hash = 14695981039346656037ull;
+				size_t Offset = 0;
+				for (; Offset + 8 <= Size; Offset += 8) {
+					Hash = (Hash ^ DecodeBinary::UInt64LE(Data + Offset)) * 1099511628211ull;
+				}
+				for (; Offset < Size; ++Offset) {
+					Hash = (Hash ^ Data[Offset]) * 1099511628211ull;
+				}
+				return Hash;
+			}
 		}
 
 		struct Convert {
@@ -96,7 +180,7 @@ namespace SAELib {
 			// &1 = ̃CuO𓊂邩
 			// &2 = G[Ot@C𐶐邩
 			// &4 = SAELibt@C쐬邩
-			// &8 = 
+			// &8 = 摜f[^̏d𕜌̉fŔ肷邩
 			// 
 			// SAELibt@C̐pXw
 			// SFFf[^JnfBNgpXw
@@ -105,6 +189,7 @@ namespace SAELib {
 			inline static constexpr int32_t kThrowError = 1 << 0;
 			inline static constexpr int32_t kCreateLogFile = 1 << 1;
 			inline static constexpr int32_t kCreateSAELibFile = 1 << 2;
+			inline static constexpr int32_t kDecodedSpriteDedup = 1 << 3;
 			inline static constexpr int32_t kDefaultConfig = 0;
 
 			// SAELibt@C̃pX
@@ -124,6 +209,7 @@ namespace SAELib {
 			[[nodiscard]] bool ThrowError() const noexcept { return (BitFlag_ & kThrowError) != 0; }
 			[[nodiscard]] bool CreateLogFile() const noexcept { return (BitFlag_ & kCreateLogFile) != 0; }
 			[[nodiscard]] bool CreateSAELibFile() const noexcept { return (BitFlag_ & kCreateSAELibFile) != 0; }
+			[[nodiscard]] bool DecodedSpriteDedup() const noexcept { return (BitFlag_ & kDecodedSpriteDedup) != 0; }
 			[[nodiscard]] const std::filesystem::path& SAELibFilePath() const noexcept { return SAELibFilePath_; }
 			[[nodiscard]] const std::filesystem::path& SFFSearchPath() const noexcept { return SFFSearchPath_; }
 
@@ -131,6 +217,7 @@ namespace SAELib {
 			void ThrowError(bool flag) { BitFlag_ = (BitFlag_ & ~kThrowError) | (flag ? kThrowError : 0); }
 			void CreateLogFile(bool flag) { BitFlag_ = (BitFlag_ & ~kCreateLogFile) | (flag ? kCreateLogFile : 0); }
 			void CreateSAELibFile(bool flag) { BitFlag_ = (BitFlag_ & ~kCreateSAELibFile) | (flag ? kCreateSAELibFile : 0); }
+			void DecodedSpriteDedup(bool flag) { BitFlag_ = (BitFlag_ & ~kDecodedSpriteDedup) | (flag ? kDecodedSpriteDedup : 0); }
 			void SAELibFilePath(const std::filesystem::path& Path) { SAELibFilePath_ = (Path.empty() ? std::filesystem::current_path() : Path); }
 			void SFFSearchPath(const std::filesystem::path& Path) { SFFSearchPath_ = (Path.empty() ? std::filesystem::current_path() : Path); }
 
@@ -194,6 +281,30 @@ namespace SAELib {
 				WriteBMPFileFailed,
 				CloseBMPFileFailed,
 				CheckBuildBMPBinaryData,
+				OpenPaletteFileFailed,
+				InvalidPaletteFileSize,
+				PaletteNumberNotFound,
+				CreateSFFFileFailed,
+				WriteSFFFileFailed,
+				CloseSFFFileFailed,
+				CreateCatalogFileFailed,
+				WriteCatalogFileFailed,
+				OpenCatalogFileFailed,
+				InvalidCatalogFile,
+				CatalogFilePathTooLong,
+				CreateSharedMemoryFailed,
+				OpenSharedMemoryFailed,
+				InvalidSharedMemory,
+				OpenAIRFileFailed,
+				InvalidAIRFrame,
+				DuplicateActionNumber,
+				CreateSFFDiffFileFailed,
+				OpenImageFileFailed,
+				InvalidImageFile,
+				InvalidSpriteParameter,
+				NoSpriteToSave,
+				SpriteDataEvicted,
+				ReloadSpriteFailed,
 			};
 
 			/**
@@ -228,6 +339,30 @@ namespace SAELib {
 				{ WriteBMPFileFailed,			"WriteBMPFileFailed",			"BMPt@C݂̏Ɏs܂" },
 				{ CloseBMPFileFailed,			"CloseBMPFileFailed",			"BMPt@C݂̏ɏI܂ł" },
 				{ CheckBuildBMPBinaryData,		"CheckBuildBMPBinaryData",		"BMPf[^\zɑzO̒lmF܂" },
+				{ OpenPaletteFileFailed,		"OpenPaletteFileFailed",		"pbgt@CJ܂ł" },
+				{ InvalidPaletteFileSize,		"InvalidPaletteFileSize",		"pbgt@C̃TCYsĂ܂" },
+				{ PaletteNumberNotFound,		"PaletteNumberNotFound",		"w肵pbgԍ܂" },
+				{ CreateSFFFileFailed,			"CreateSFFFileFailed",			"SFFt@C̍쐬Ɏs܂" },
+				{ WriteSFFFileFailed,			"WriteSFFFileFailed",			"SFFt@C݂̏Ɏs܂" },
+				{ CloseSFFFileFailed,			"CloseSFFFileFailed",			"SFFt@C݂̏ɏI܂ł" },
+				{ CreateCatalogFileFailed,		"CreateCatalogFileFailed",		"J^Ot@C̍쐬Ɏs܂" },
+				{ WriteCatalogFileFailed,		"WriteCatalogFileFailed",		"J^Ot@C݂̏Ɏs܂" },
+				{ OpenCatalogFileFailed,		"OpenCatalogFileFailed",		"J^Ot@CJ܂ł" },
+				{ InvalidCatalogFile,			"InvalidCatalogFile",			"J^Ot@Č`܂" },
+				{ CatalogFilePathTooLong,		"CatalogFilePathTooLong",		"J^Oɕۑł钷(65535Byte)𒴂t@CpX܂܂Ă܂" },
+				{ CreateSharedMemoryFailed,		"CreateSharedMemoryFailed",		"L̍쐬Ɏs܂" },
+				{ OpenSharedMemoryFailed,		"OpenSharedMemoryFailed",		"Lւ̐ڑɎs܂" },
+				{ InvalidSharedMemory,			"InvalidSharedMemory",			"LSFFf[^̌`܂" },
+				{ OpenAIRFileFailed,			"OpenAIRFileFailed",			"AIRt@CJ܂ł" },
+				{ InvalidAIRFrame,				"InvalidAIRFrame",				"AIRt@C̃t[񂪐܂" },
+				{ DuplicateActionNumber,		"DuplicateActionNumber",		"AIRt@C̃ANVԍdĂ܂" },
+				{ CreateSFFDiffFileFailed,		"CreateSFFDiffFileFailed",		"t@C̍쐬Ɏs܂" },
+				{ OpenImageFileFailed,			"OpenImageFileFailed",			"摜t@CJ܂ł" },
+				{ InvalidImageFile,				"InvalidImageFile",				"摜t@Č`8bitBMP/PCXł͂܂" },
+				{ InvalidSpriteParameter,		"InvalidSpriteParameter",		"ǉ摜̔ԍEWETCYSFFv1`͈̔͊Oł" },
+				{ NoSpriteToSave,				"NoSpriteToSave",				"ۑ摜ǉĂ܂" },
+				{ SpriteDataEvicted,			"SpriteDataEvicted",			"摜f[^Ă܂(ReloadœǂݍݒĂ)" },
+				{ ReloadSpriteFailed,			"ReloadSpriteFailed",			"摜f[^̍ēǂݍ݂Ɏs܂(ǂݍ݌̃t@CύX܂͍폜Ă܂)" },
 			};
 
 			/**
@@ -288,8 +423,10 @@ namespace SAELib {
 				}
 			};
 			std::vector<T_ErrorList> ErrorList = {};
+			std::mutex ErrorListMutex = {}; // 񓯊ǂݍݒ͕ʃXbhǉ
 
 			void InitErrorList() {
+				std::lock_guard<std::mutex> Lock(ErrorListMutex);
 				ErrorList.clear();
 			}
 
@@ -301,14 +438,17 @@ namespace SAELib {
 
 		public:
 			void AddErrorList(int32_t ErrorID) {
+				std::lock_guard<std::mutex> Lock(ErrorListMutex);
 				ErrorList.emplace_back(T_ErrorList(ErrorID));
 			}
 
 			void AddErrorList(int32_t ErrorID, int32_t ErrorValue) {
+				std::lock_guard<std::mutex> Lock(ErrorListMutex);
 				ErrorList.emplace_back(T_ErrorList(ErrorID, ErrorValue));
 			}
 
 			void AddErrorList(int32_t ErrorID, int32_t GroupNo, int32_t ImageNo) {
+				std::lock_guard<std::mutex> Lock(ErrorListMutex);
 				ErrorList.emplace_back(T_ErrorList(ErrorID, Convert::EncodeIntHalf(GroupNo, ImageNo)));
 			}
 
@@ -349,6 +489,7 @@ namespace SAELib {
 			}
 
 			void WriteErrorLog(std::ofstream& File) {
+				std::unique_lock<std::mutex> Lock(ErrorListMutex);
 				File << "ReadSffFile ErrorLog" << "\n";
 				File << "G[: " << ErrorList.size() << "\n";
 
@@ -358,11 +499,18 @@ namespace SAELib {
 					if (Error.ErrorID() == ErrorMessage::DuplicateSpriteNumber || Error.ErrorID() == ErrorMessage::SpriteNumberNotFound) {
 						File << "G[l: " << Convert::DecodeSpriteGroupNo(Error.ErrorValue()) << "-" << Convert::DecodeSpriteImageNo(Error.ErrorValue()) << "\n";
 					}
-					if (Error.ErrorID() == ErrorMessage::SpriteIndexNotFound) {
+					if (Error.ErrorID() == ErrorMessage::SpriteIndexNotFound || Error.ErrorID() == ErrorMessage::PaletteNumberNotFound) {
+						File << "G[l: " << Error.ErrorValue() << "\n";
+					}
+					if (Error.ErrorID() == ErrorMessage::InvalidAIRFrame) {
+						File << "G[s: " << Error.ErrorValue() << "\n";
+					}
+					if (Error.ErrorID() == ErrorMessage::DuplicateActionNumber) {
 						File << "G[l: " << Error.ErrorValue() << "\n";
 					}
 				}
 				File.flush();
+				Lock.unlock();
 
 				if (File.fail() || File.bad()) {
 					if (T_Config::Instance().ThrowError()) {
@@ -413,6 +561,549 @@ namespace SAELib {
 			}
 		};
 
+#ifdef SAELIB_SFF_SHARED_MEMORY
+		// OtL(POSIXL܂Windows̖Ott@C}bsO)
+		// 쐬CX^XjƖO폜Aȍ~͐ڑłȂȂ(ڑς݂̃vZX͂̂܂܎QƂł)
+		struct T_SharedMemory {
+		private:
+			std::string Name_ = {};
+			unsigned char* Data_ = nullptr;
+			size_t Size_ = 0;
+			bool Owner_ = false;
+#if defined(_WIN32)
+			HANDLE Handle_ = nullptr;
+#endif
+
+			// POSIXL̖O'/'n߂
+			[[nodiscard]] static std::string SystemName(const std::string& Name) {
+#if defined(_WIN32)
+				return Name;
+#else
+				return (!Name.empty() && Name.front() == '/' ? Name : "/" + Name);
+#endif
+			}
+
+			void Release() noexcept {
+#if defined(_WIN32)
+				if (Data_) { UnmapViewOfFile(Data_); }
+				if (Handle_) { CloseHandle(Handle_); }
+				Handle_ = nullptr;
+#else
+				if (Data_) { munmap(Data_, Size_); }
+				if (Owner_) { shm_unlink(SystemName(Name_).c_str()); }
+#endif
+				Name_.clear();
+				Data_ = nullptr;
+				Size_ = 0;
+				Owner_ = false;
+			}
+
+			void Swap(T_SharedMemory& Other) noexcept {
+				std::swap(Name_, Other.Name_);
+				std::swap(Data_, Other.Data_);
+				std::swap(Size_, Other.Size_);
+				std::swap(Owner_, Other.Owner_);
+#if defined(_WIN32)
+				std::swap(Handle_, Other.Handle_);
+#endif
+			}
+
+		public:
+			/**
+			* @brief L̗LmF
+			*
+			* @return bool 茋 (false = Ftrue = L)
+			*/
+			bool valid() const noexcept { return Data_ != nullptr; }
+
+			/**
+			* @brief L̖O擾
+			*
+			* @return const std::string& Name L̖O
+			*/
+			const std::string& Name() const noexcept { return Name_; }
+
+			/**
+			* @brief L̃oCg擾
+			*
+			* @return size_t Size L̃oCg
+			*/
+			size_t size() const noexcept { return Size_; }
+
+			[[nodiscard]] const unsigned char* data() const noexcept { return Data_; }
+			[[nodiscard]] unsigned char* data() noexcept { return Data_; }
+
+			// ݉\ȋL쐬(O݂ꍇ͎s)
+			[[nodiscard]] bool Create(const std::string& Name, size_t Size) {
+				Release();
+				if (Name.empty() || !Size) { return false; }
+#if defined(_WIN32)
+				Handle_ = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(static_cast<uint64_t>(Size) >> 32), static_cast<DWORD>(Size), SystemName(Name).c_str());
+				if (!Handle_) { return false; }
+				if (GetLastError() == ERROR_ALREADY_EXISTS) {
+					Release();
+					return false;
+				}
+				Data_ = static_cast<unsigned char*>(MapViewOfFile(Handle_, FILE_MAP_WRITE, 0, 0, Size));
+#else
+				const int Descriptor = shm_open(SystemName(Name).c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+				if (Descriptor < 0) { return false; }
+				Owner_ = true;
+				Name_ = Name;
+				if (ftruncate(Descriptor, static_cast<off_t>(Size)) == 0) {
+					void* const Map = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, Descriptor, 0);
+					Data_ = (Map != MAP_FAILED ? static_cast<unsigned char*>(Map) : nullptr);
+				}
+				close(Descriptor);
+#endif
+				if (!Data_) {
+					Release();
+					return false;
+				}
+				Name_ = Name;
+				Size_ = Size;
+				Owner_ = true;
+				return true;
+			}
+
+			// O폜(ُIJcOpAڑς݂̃vZX͂̂܂܎QƂł)
+			// Windowsł͑SẴnhꂽ_ŖO邽߉Ȃ
+			static bool Unlink(const std::string& Name) noexcept {
+				if (Name.empty()) { return false; }
+#if defined(_WIN32)
+				return true;
+#else
+				return shm_unlink(SystemName(Name).c_str()) == 0;
+#endif
+			}
+
+			// ̋L֓ǂݎpŐڑ
+			[[nodiscard]] bool Open(const std::string& Name) {
+				Release();
+				if (Name.empty()) { return false; }
+#if defined(_WIN32)
+				Handle_ = OpenFileMappingA(FILE_MAP_READ, FALSE, SystemName(Name).c_str());
+				if (!Handle_) { return false; }
+				Data_ = static_cast<unsigned char*>(MapViewOfFile(Handle_, FILE_MAP_READ, 0, 0, 0));
+				MEMORY_BASIC_INFORMATION Info = {};
+				if (Data_ && VirtualQuery(Data_, &Info, sizeof(Info))) { Size_ = Info.RegionSize; } // y[WPʂɐ؂グꂽTCY
+#else
+				const int Descriptor = shm_open(SystemName(Name).c_str(), O_RDONLY, 0);
+				if (Descriptor < 0) { return false; }
+				struct stat Stat = {};
+				if (fstat(Descriptor, &Stat) == 0 && Stat.st_size > 0) {
+					void* const Map = mmap(nullptr, static_cast<size_t>(Stat.st_size), PROT_READ, MAP_SHARED, Descriptor, 0);
+					if (Map != MAP_FAILED) {
+						Data_ = static_cast<unsigned char*>(Map);
+						Size_ = static_cast<size_t>(Stat.st_size);
+					}
+				}
+				close(Descriptor);
+#endif
+				if (!Data_ || !Size_) {
+					Release();
+					return false;
+				}
+				Name_ = Name;
+				return true;
+			}
+
+		public:
+			T_SharedMemory() = default;
+			T_SharedMemory(const T_SharedMemory&) = delete;
+			T_SharedMemory& operator=(const T_SharedMemory&) = delete;
+
+			T_SharedMemory(T_SharedMemory&& Other) noexcept {
+				Swap(Other);
+			}
+
+			T_SharedMemory& operator=(T_SharedMemory&& Other) noexcept {
+				if (this != &Other) {
+					Release();
+					Swap(Other);
+				}
+				return *this;
+			}
+
+			~T_SharedMemory() {
+				Release();
+			}
+		};
+#endif
+
+		// 񏈗̍1(vf͈̔͂ƏAŏɔO)
+		// vf͎QXbhƂ̒S͈͂ɕAS͈͂IXbh͑̒S͈͂̌㔼Dď
+		struct T_ParallelJob {
+		private:
+			// S͈(LXbh͐擪ADXbh͌㔼o)
+			struct alignas(64) T_WorkRange {
+				std::mutex Mutex;
+				size_t Begin = 0;
+				size_t End = 0;
+			};
+
+			const size_t kCount;
+			const size_t kNumRange;
+			const void* const kContext;			// Ăяȍ(ĂяõXbh҂ߎQƂ̂ݕێ)
+			void (* const kInvoke)(const void*, size_t);
+			std::unique_ptr<T_WorkRange[]> RangeList_;
+			std::atomic<size_t> NextRange_ = 0;	// ɎQXbh̒S͈
+			std::atomic<bool> Canceled_ = false; // O͎̔c̗vfȂ
+			std::exception_ptr Exception_ = {};
+			size_t NumFinished_ = 0;
+			mutable std::mutex Mutex;
+			std::condition_variable ConditionVariable;
+
+			// S͈͂̐擪1o
+			[[nodiscard]] bool PopFront(size_t Owner, size_t& index) {
+				T_WorkRange& Range = RangeList_[Owner];
+				std::lock_guard<std::mutex> Lock(Range.Mutex);
+				if (Range.Begin >= Range.End) { return false; }
+				index = Range.Begin++;
+				return true;
+			}
+
+			// ̒S͈͂̌㔼D1oAc̒S͈͂ֈڂ(S͈͂ȂXbh͖1̂ݒD)
+			[[nodiscard]] bool Steal(size_t Thief, size_t& index) {
+				for (size_t n = 1; n <= kNumRange; ++n) {
+					T_WorkRange& Victim = RangeList_[(Thief + n) % kNumRange];
+					size_t Begin = 0;
+					size_t End = 0;
+					{
+						std::lock_guard<std::mutex> Lock(Victim.Mutex);
+						if (Victim.Begin >= Victim.End) { continue; }
+						Begin = (Thief < kNumRange ? Victim.Begin + (Victim.End - Victim.Begin) / 2 : Victim.End - 1);
+						End = Victim.End;
+						Victim.End = Begin;
+					}
+					index = Begin;
+					if (Begin + 1 < End) {
+						T_WorkRange& Range = RangeList_[Thief];
+						std::lock_guard<std::mutex> Lock(Range.Mutex);
+						Range.Begin = Begin + 1;
+						Range.End = End;
+					}
+					return true;
+				}
+				return false;
+			}
+
+		public:
+			// ̗vfȂȂ܂ŏ(eXbh瓯ɌĂяo)
+			void Work() {
+				const size_t Owner = NextRange_++;
+				size_t NumProcessed = 0;
+				size_t index = 0;
+				while ((Owner < kNumRange && PopFront(Owner, index)) || Steal(Owner, index)) {
+					if (!Canceled_.load(std::memory_order_relaxed)) {
+						try {
+							kInvoke(kContext, index);
+						}
+						catch (...) {
+							std::lock_guard<std::mutex> Lock(Mutex);
+							if (!Exception_) { Exception_ = std::current_exception(); }
+							Canceled_.store(true, std::memory_order_relaxed);
+						}
+					}
+					++NumProcessed;
+				}
+				if (!NumProcessed) { return; }
+				std::lock_guard<std::mutex> Lock(Mutex);
+				NumFinished_ += NumProcessed;
+				if (NumFinished_ == kCount) { ConditionVariable.notify_all(); }
+			}
+
+			// SĂ̗vf̏I܂őҋ@Aŏ̗Ođo(O͍ƂoAĂяô݂ێ)
+			void Wait() {
+				std::exception_ptr Exception = {};
+				{
+					std::unique_lock<std::mutex> Lock(Mutex);
+					ConditionVariable.wait(Lock, [this] { return NumFinished_ == kCount; });
+					Exception = std::move(Exception_);
+				}
+				if (Exception) { std::rethrow_exception(Exception); }
+			}
+
+		public:
+			// vfNumRange̒S͈͂֋ϓɕ
+			T_ParallelJob(size_t Count, size_t NumRange, const void* Context, void (*Invoke)(const void*, size_t))
+				: kCount(Count), kNumRange((std::max<size_t>)(1, NumRange)), kContext(Context), kInvoke(Invoke), RangeList_(new T_WorkRange[kNumRange]) {
+				for (size_t Range = 0; Range < kNumRange; ++Range) {
+					RangeList_[Range].Begin = kCount * Range / kNumRange;
+					RangeList_[Range].End = kCount * (Range + 1) / kNumRange;
+				}
+			}
+		};
+
+		// 񏈗̍ƃXbh(gpɐAvZXI܂Ŏg)
+		struct T_ThreadPool {
+		private:
+			std::vector<std::thread> ThreadList = {};
+			std::deque<std::shared_ptr<T_ParallelJob>> JobQueue = {};
+			bool Stop = false;
+			std::mutex Mutex;
+			std::condition_variable ConditionVariable;
+
+			void WorkerLoop() {
+				for (;;) {
+					std::shared_ptr<T_ParallelJob> Job = {};
+					{
+						std::unique_lock<std::mutex> Lock(Mutex);
+						ConditionVariable.wait(Lock, [this] { return Stop || !JobQueue.empty(); });
+						if (JobQueue.empty()) { return; }
+						Job = JobQueue.front();
+					}
+					Job->Work();
+					Remove(Job);
+				}
+			}
+
+			// vfzIƂ҂s񂩂O
+			void Remove(const std::shared_ptr<T_ParallelJob>& Job) {
+				std::lock_guard<std::mutex> Lock(Mutex);
+				const auto it = std::find(JobQueue.begin(), JobQueue.end(), Job);
+				if (it != JobQueue.end()) { JobQueue.erase(it); }
+			}
+
+			T_ThreadPool() {
+				const unsigned NumThread = (std::max)(1u, std::thread::hardware_concurrency()) - 1; // ĂяõXbhɎQ
+				ThreadList.reserve(NumThread);
+				for (unsigned i = 0; i < NumThread; ++i) {
+					ThreadList.emplace_back([this] { WorkerLoop(); });
+				}
+			}
+
+		public:
+			T_ThreadPool(const T_ThreadPool&) = delete;
+			T_ThreadPool& operator=(const T_ThreadPool&) = delete;
+
+			~T_ThreadPool() {
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					Stop = true;
+				}
+				ConditionVariable.notify_all();
+				for (auto& Thread : ThreadList) {
+					Thread.join();
+				}
+			}
+
+			[[nodiscard]] static T_ThreadPool& Instance() {
+				static T_ThreadPool instance;
+				return instance;
+			}
+
+			[[nodiscard]] size_t NumThread() const noexcept { return ThreadList.size(); }
+
+			// Ƃ҂s֒ǉAĂяõXbhɎQĊ҂
+			// ƃXbȟĂяołAĂяoc̗vf邽ߑ҂邱Ƃ͂Ȃ
+			void Run(const std::shared_ptr<T_ParallelJob>& Job, size_t NumHelper) {
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					JobQueue.emplace_back(Job);
+				}
+				for (size_t i = 0; i < NumHelper; ++i) {
+					ConditionVariable.notify_one();
+				}
+				Job->Work();
+				Remove(Job);
+				Job->Wait();
+			}
+		};
+
+		// 񏈗̕⏕(vfƂ̏ƃXbh֕z)
+		// ɑoꂽO͌ĂяõXbhōđo(ŏ1̂݁Aȍ~̗vf͏Ȃ)
+		struct T_ParallelFor {
+		public:
+			template <class Function>
+			static void Run(size_t Count, Function&& Func) {
+				if (Count <= 1 || std::thread::hardware_concurrency() <= 1) {
+					for (size_t index = 0; index < Count; ++index) {
+						Func(index);
+					}
+					return;
+				}
+
+				using T_Function = std::remove_reference_t<Function>;
+				const auto Invoke = [](const void* Context, size_t index) { (*static_cast<T_Function*>(const_cast<void*>(Context)))(index); };
+				T_ThreadPool& ThreadPool = T_ThreadPool::Instance();
+				const size_t NumHelper = (std::min)(Count - 1, ThreadPool.NumThread());
+				ThreadPool.Run(std::make_shared<T_ParallelJob>(Count, NumHelper + 1, static_cast<const void*>(std::addressof(Func)), Invoke), NumHelper);
+			}
+		};
+
+		// ꊇ̑ΏۂƂȂ.sfft@C̎W
+		struct T_SFFFileSearch {
+		private:
+			// gq.sff(啶ʂȂ)
+			[[nodiscard]] static bool IsSFFExtension(const std::filesystem::path& FilePath) {
+				const std::filesystem::path Extension = FilePath.extension();
+				const auto& Native = Extension.native();
+				if (Native.size() != SFFFormat::kExtension.size()) { return false; }
+				for (size_t index = 0; index < Native.size(); ++index) {
+					const auto Char = Native[index];
+					if ((Char >= 'A' && Char <= 'Z' ? Char - 'A' + 'a' : Char) != SFFFormat::kExtension[index]) { return false; }
+				}
+				return true;
+			}
+
+		public:
+			// t@CȂ炻̃t@CAtH_Ȃȉ̑SĂ.sfft@CԂ
+			// ANZXłȂڂ͓ǂݔ΂A𑱂ȂȂꍇ͂܂łɌt@CԂ
+			[[nodiscard]] static std::vector<std::filesystem::path> Collect(const std::string& Path) {
+				std::vector<std::filesystem::path> FilePathList = {};
+				std::error_code ErrorCode = {};
+				if (std::filesystem::is_regular_file(Path, ErrorCode)) {
+					FilePathList.emplace_back(Path);
+					return FilePathList;
+				}
+				if (!std::filesystem::is_directory(Path, ErrorCode)) { return FilePathList; }
+
+				const std::filesystem::recursive_directory_iterator End = {};
+				for (std::filesystem::recursive_directory_iterator it(Path, std::filesystem::directory_options::skip_permission_denied, ErrorCode); !ErrorCode && it != End; it.increment(ErrorCode)) {
+					std::error_code EntryErrorCode = {};
+					if (it->is_regular_file(EntryErrorCode) && IsSFFExtension(it->path())) {
+						FilePathList.emplace_back(it->path());
+					}
+				}
+				return FilePathList;
+			}
+		};
+
+		// 摜f[^(PCX)̐
+		// ؍ς݂̉摜f[^͋E`FbNȂŕł
+		// 摜̕s(pbgԍ0ȊO)͂ދ`
+		struct T_OpaqueRect {
+			uint16_t X = 0;
+			uint16_t Y = 0;
+			uint16_t Width = 0;
+			uint16_t Height = 0;
+
+			[[nodiscard]] bool operator==(const T_OpaqueRect& Other) const noexcept {
+				return X == Other.X && Y == Other.Y && Width == Other.Width && Height == Other.Height;
+			}
+		};
+
+		struct T_VerifySpriteBinary {
+		private:
+			inline static constexpr unsigned char kBitsPerPixel = 8;
+
+			const unsigned char* const kSpriteBinary;
+			const ksize_t kSpriteBinarySize;
+			T_OpaqueRect OpaqueRect_ = {}; // kVerified̏ɐݒ肷邽ߐɐ錾
+			const bool kVerified;
+
+			[[nodiscard]] unsigned char BitsPerPixel() const noexcept { return kSpriteBinary[3]; }
+			[[nodiscard]] uint16_t Xmax() const noexcept { return 1 + DecodeBinary::UInt16LE(&kSpriteBinary[8]); }
+			[[nodiscard]] uint16_t Ymax() const noexcept { return 1 + DecodeBinary::UInt16LE(&kSpriteBinary[10]); }
+			[[nodiscard]] uint16_t BytesPerLine() const noexcept { return DecodeBinary::UInt16LE(&kSpriteBinary[66]); }
+
+			[[nodiscard]] bool CheckHeader() const noexcept {
+				if (kSpriteBinarySize <= SFFFormat::kSpriteBinaryPixelOffbits) { return false; }
+				return BitsPerPixel() == kBitsPerPixel && BytesPerLine() != 0 && BytesPerLine() >= Xmax();
+			}
+
+			// DecodeSFFSpriteToBMPƓ菇RLEHAG[؂l߂ȂƂmF
+			// ɕs̋`߂(RLE̘APʂŔ肷邽ߓȗ]͓WJɓǂݔ΂)
+			[[nodiscard]] bool CheckRLEStream() noexcept {
+				ksize_t SpriteBinaryOffSet = SFFFormat::kSpriteBinaryPixelOffbits;
+				uint16_t Left = Xmax(), Top = Ymax(), Right = 0, Bottom = 0;
+				for (int32_t y = 0; y < Ymax(); ++y) {
+					uint16_t DecodePtrOffSet = 0;
+					while (DecodePtrOffSet < BytesPerLine()) {
+						if (SpriteBinaryOffSet + 1 >= kSpriteBinarySize) { return false; } // f[^s
+						uint8_t Byte = kSpriteBinary[SpriteBinaryOffSet++];
+						int32_t FillCount = 1;
+						if ((Byte & 0xC0) == 0xC0) {
+							FillCount = Byte & 0x3F;
+							Byte = kSpriteBinary[SpriteBinaryOffSet++];
+							if (FillCount > BytesPerLine() - DecodePtrOffSet) { return false; } // sׂ
+						}
+						// s̗](BytesPerLinẽpfBO)͉摜Ɋ܂܂Ȃ
+						if (Byte && FillCount && DecodePtrOffSet < Xmax()) {
+							Left = (std::min)(Left, DecodePtrOffSet);
+							Right = (std::max)(Right, static_cast<uint16_t>((std::min)(DecodePtrOffSet + FillCount, static_cast<int32_t>(Xmax()))));
+							Top = (std::min)(Top, static_cast<uint16_t>(y));
+							Bottom = static_cast<uint16_t>(y + 1);
+						}
+						DecodePtrOffSet += FillCount;
+					}
+				}
+				if (Left < Right) {
+					OpaqueRect_ = { Left, Top, static_cast<uint16_t>(Right - Left), static_cast<uint16_t>(Bottom - Top) };
+				}
+				return true;
+			}
+
+		public:
+			T_VerifySpriteBinary(const unsigned char* const SpriteBinary, ksize_t SpriteBinarySize)
+				: kSpriteBinary(SpriteBinary), kSpriteBinarySize(SpriteBinarySize), kVerified(CheckHeader() && CheckRLEStream()) {
+				// ؂łȂ摜͑ŜsƂĈ
+				if (!kVerified && kSpriteBinarySize > SFFFormat::kSpriteBinaryPixelOffbits) {
+					OpaqueRect_ = { 0, 0, Xmax(), Ymax() };
+				}
+			}
+
+			[[nodiscard]] bool Verified() const noexcept {
+				return kVerified;
+			}
+
+			[[nodiscard]] const T_OpaqueRect& OpaqueRect() const noexcept {
+				return OpaqueRect_;
+			}
+		};
+
+		// ؍ς݂̉摜f[^s̗]f𕜌(̉fɂdp)
+		// 𑜓xȂǂ̃wb_[RLËk@̈Ⴂ܂܂A摜TCYƉf݂̂ێ
+		struct T_DecodedSpritePixel {
+		private:
+			std::vector<unsigned char> Pixel_ = {}; // 擪4ByteɕƍAȍ~Ɋes̉f
+			uint64_t Hash_ = 0;
+
+			void Decode(const unsigned char* const SpriteBinary) {
+				const uint16_t Width = 1 + DecodeBinary::UInt16LE(&SpriteBinary[8]);
+				const uint16_t Height = 1 + DecodeBinary::UInt16LE(&SpriteBinary[10]);
+				const uint16_t BytesPerLine = DecodeBinary::UInt16LE(&SpriteBinary[66]);
+				Pixel_.resize(4 + static_cast<size_t>(Width) * Height);
+				std::memcpy(Pixel_.data(), &SpriteBinary[8], 4);
+
+				const unsigned char* SpritePtr = SpriteBinary + SFFFormat::kSpriteBinaryPixelOffbits;
+				unsigned char* PixelPtr = Pixel_.data() + 4;
+				for (int32_t y = 0; y < Height; ++y, PixelPtr += Width) {
+					int32_t DecodePtrOffSet = 0;
+					while (DecodePtrOffSet < BytesPerLine) {
+						uint8_t Byte = *SpritePtr++;
+						int32_t FillCount = 1;
+						if ((Byte & 0xC0) == 0xC0) {
+							FillCount = Byte & 0x3F;
+							Byte = *SpritePtr++;
+						}
+						if (DecodePtrOffSet < Width) {
+							std::memset(PixelPtr + DecodePtrOffSet, Byte, (std::min)(FillCount, Width - DecodePtrOffSet));
+						}
+						DecodePtrOffSet += FillCount;
+					}
+				}
+			}
+
+			void CalcHash() noexcept {
+				Hash_ = HashBinary::FNV1a64(Pixel_.data(), Pixel_.size());
+			}
+
+		public:
+			[[nodiscard]] uint64_t Hash() const noexcept { return Hash_; }
+
+			[[nodiscard]] bool operator==(const T_DecodedSpritePixel& Other) const noexcept {
+				return Hash_ == Other.Hash_ && Pixel_ == Other.Pixel_;
+			}
+
+			// T_VerifySpriteBinaryŌ؍ς݂̉摜f[^p
+			explicit T_DecodedSpritePixel(const unsigned char* const SpriteBinary) {
+				Decode(SpriteBinary);
+				CalcHash();
+			}
+		};
+
 		// BMPoCi
 		struct T_BuildBMPBinary {
 		private:
@@ -423,19 +1114,27 @@ namespace SAELib {
 			const unsigned char* const kSpriteBinary;
 			const unsigned char* const kPaletteBinary;
 			const ksize_t kSpriteBinarySize;
-			std::vector<unsigned char> BMPBinary;
-			std::vector<unsigned char> DecideBinary;
+			const bool kVerified;
+			const bool kTrimmed; // trueȂkTrimRect̋`݂̂o
+			const T_OpaqueRect kTrimRect; // ͈(BytesPerLine~Ss)Ɏ߂`
+			const unsigned char* const kDecodedBinary; // nullptrłȂΕς݂̉fgp(ȗ)
+			std::pmr::vector<unsigned char> BMPBinary; // Ɨ̈(ScratchResourcem)
+			std::pmr::vector<unsigned char> DecideBinary;
 
 			[[nodiscard]] unsigned char BitsPerPixel() const noexcept { return kSpriteBinary[3]; }
 			[[nodiscard]] uint16_t Xmax() const noexcept { return 1 + DecodeBinary::UInt16LE(&kSpriteBinary[8]); }
 			[[nodiscard]] uint16_t Ymax() const noexcept { return 1 + DecodeBinary::UInt16LE(&kSpriteBinary[10]); }
 			[[nodiscard]] uint32_t HRes() const noexcept { return static_cast<uint32_t>(DecodeBinary::UInt16LE(&kSpriteBinary[12]) * 39.3701); } // Ӗ̂vZs
 			[[nodiscard]] uint32_t VRes() const noexcept { return static_cast<uint32_t>(DecodeBinary::UInt16LE(&kSpriteBinary[14]) * 39.3701); }
-			[[nodiscard]] ksize_t ImageDataSize() const noexcept { return ((Xmax() * BitsPerPixel() + 31) / 32) * 4 * Ymax(); }
+			[[nodiscard]] uint16_t BMPWidth() const noexcept { return (kTrimmed ? kTrimRect.Width : Xmax()); }
+			[[nodiscard]] uint16_t BMPHeight() const noexcept { return (kTrimmed ? kTrimRect.Height : Ymax()); }
+			[[nodiscard]] ksize_t ImageDataSize() const noexcept { return ((BMPWidth() * BitsPerPixel() + 31) / 32) * 4 * BMPHeight(); }
 			[[nodiscard]] ksize_t FileSize() const noexcept { return kBMPHeaderSize + kBMPPaletteSize + ImageDataSize(); }
 			[[nodiscard]] uint16_t BytesPerLine() const noexcept { return DecodeBinary::UInt16LE(&kSpriteBinary[66]); }
-			[[nodiscard]] uint8_t BMPScanlinePadding() const noexcept { return (4 - (BytesPerLine() % 4)) % 4; }
-			[[nodiscard]] ksize_t BMPBinarySize() const noexcept { return kBMPPixelOffBits + (BytesPerLine() + BMPScanlinePadding()) * Ymax(); }
+			[[nodiscard]] uint16_t BMPBytesPerLine() const noexcept { return (kTrimmed ? kTrimRect.Width : BytesPerLine()); }
+			[[nodiscard]] uint8_t BMPScanlinePadding() const noexcept { return (4 - (BMPBytesPerLine() % 4)) % 4; }
+			[[nodiscard]] ksize_t BMPBinarySize() const noexcept { return kBMPPixelOffBits + (BMPBytesPerLine() + BMPScanlinePadding()) * BMPHeight(); }
+			[[nodiscard]] uint16_t DecideRows() const noexcept { return (kTrimmed ? kTrimRect.Y + kTrimRect.Height : Ymax()); } // `艺̍s͕Ȃ
 
 			[[nodiscard]] inline static constexpr unsigned char Buffer1(uint16_t value) noexcept { return (value & 0xFF); }
 			[[nodiscard]] inline static constexpr unsigned char Buffer2(uint16_t value) noexcept { return (value >> 8) & 0xFF; }
@@ -450,9 +1149,21 @@ namespace SAELib {
 			[[nodiscard]] inline static constexpr unsigned char Buffer3(size_t value) noexcept { return (value >> 16) & 0xFF; }
 			[[nodiscard]] inline static constexpr unsigned char Buffer4(size_t value) noexcept { return (value >> 24) & 0xFF; }
 
+			// ؂̉摜͋`摜S(Xmax~Ymax)ɂȂ邽߁ABytesPerLineXmaxZꍇ͈͂𒴂Ȃ悤؂l߂
+			[[nodiscard]] static T_OpaqueRect ClampTrimRect(const unsigned char* const SpriteBinary, const T_OpaqueRect* const TrimRect) noexcept {
+				if (!TrimRect) { return {}; }
+				const uint16_t BytesPerLine = DecodeBinary::UInt16LE(&SpriteBinary[66]);
+				const uint16_t Rows = 1 + DecodeBinary::UInt16LE(&SpriteBinary[10]);
+				const uint16_t X = (std::min)(TrimRect->X, BytesPerLine);
+				const uint16_t Y = (std::min)(TrimRect->Y, Rows);
+				return { X, Y, (std::min)(TrimRect->Width, static_cast<uint16_t>(BytesPerLine - X)), (std::min)(TrimRect->Height, static_cast<uint16_t>(Rows - Y)) };
+			}
+
 			void InitBinaryBuffers() {
 				BMPBinary.resize(BMPBinarySize());
-				DecideBinary.resize(static_cast<size_t>(BytesPerLine()) * Ymax());
+				if (!kDecodedBinary) {
+					DecideBinary.resize(static_cast<size_t>(BytesPerLine()) * DecideRows());
+				}
 			}
 
 			void SetBMPHeader() {
@@ -463,8 +1174,8 @@ namespace SAELib {
 					, 0x00, 0x00				// \̈2
 					, Buffer1(kBMPPixelOffBits), Buffer2(kBMPPixelOffBits), Buffer3(kBMPPixelOffBits), Buffer4(kBMPPixelOffBits)	// t@C擪sNZf[^ւ̃ItZbg
 					, 0x28, 0x00, 0x00, 0x00	// wb_[TCY(40)
-					, Buffer1(Xmax()), Buffer2(Xmax()), 0x00, 0x00	// sNZTCYX
-					, Buffer1(Ymax()), Buffer2(Ymax()), 0x00, 0x00	// sNZTCYY
+					, Buffer1(BMPWidth()), Buffer2(BMPWidth()), 0x00, 0x00	// sNZTCYX
+					, Buffer1(BMPHeight()), Buffer2(BMPHeight()), 0x00, 0x00	// sNZTCYY
 					, 0x01, 0x00				// J[v[(1)
 					, BitsPerPixel(), 0x00		// rbg
 					, 0x00, 0x00, 0x00, 0x00	// k`
@@ -477,50 +1188,38 @@ namespace SAELib {
 				std::memcpy(BMPBinary.data(), header, sizeof(header));
 			}
 
-			void AssignPaletteToBMP() {
-				unsigned char* PalettePtr = BMPBinary.data() + kBMPHeaderSize;
+			inline static void AssignPaletteToBMP(unsigned char* const BMPBinaryData, const unsigned char* const PaletteBinary) noexcept {
+				unsigned char* PalettePtr = BMPBinaryData + kBMPHeaderSize;
 				for (int32_t i = 0; i < 256; i++) {
-					PalettePtr[i * 4 + 0] = kPaletteBinary[i * 3 + 2]; // B
-					PalettePtr[i * 4 + 1] = kPaletteBinary[i * 3 + 1]; // G
-					PalettePtr[i * 4 + 2] = kPaletteBinary[i * 3 + 0]; // R
-					PalettePtr[i * 4 + 3] = 0x00;					   // A
+					PalettePtr[i * 4 + 0] = PaletteBinary[i * 3 + 2]; // B
+					PalettePtr[i * 4 + 1] = PaletteBinary[i * 3 + 1]; // G
+					PalettePtr[i * 4 + 2] = PaletteBinary[i * 3 + 0]; // R
+					PalettePtr[i * 4 + 3] = 0x00;					  // A
 				}
 			}
 
-			void DecodeSFFSpriteToBMP() {
-				ksize_t SpriteBinaryOffSet = SFFFormat::kSpriteBinaryPixelOffbits; // 摜f[^Jnʒu
-				for (int32_t y = 0; y < Ymax(); ++y) {
-					unsigned char* DecidePtr = DecideBinary.data() + y * BytesPerLine();
-					uint16_t DecodePtrOffSet = 0;
+			void AssignPaletteToBMP() {
+				AssignPaletteToBMP(BMPBinary.data(), kPaletteBinary);
+			}
 
-					while (DecodePtrOffSet < BytesPerLine() && SpriteBinaryOffSet < kSpriteBinarySize) {
-						uint8_t Byte = kSpriteBinary[SpriteBinaryOffSet++];
-						if (SpriteBinaryOffSet >= kSpriteBinarySize) { // zO̒l΍
-							T_ErrorHandle::Instance().SetError(ErrorMessage::CheckBuildBMPBinaryData);
-							break;
-						}
+			void DecodeSFFSpriteToBMP() {
+				DecodeSprite(kSpriteBinary, kSpriteBinarySize, DecideBinary.data(), DecideRows());
+			}
 
-						// RLEk߂̔
-						if ((Byte & 0xC0) == 0xC0) {
-							int32_t FillCount = Byte & 0x3F; // ݐ
-							uint8_t FillValue = kSpriteBinary[SpriteBinaryOffSet++]; // ޒl
-							int32_t CopyFillCount = (FillCount <= BytesPerLine() - DecodePtrOffSet ? FillCount : BytesPerLine() - DecodePtrOffSet); // ۂ̏ݐ
-							std::memset(DecidePtr + DecodePtrOffSet, FillValue, CopyFillCount);
-							DecodePtrOffSet += CopyFillCount;
-						}
-						else {
-							DecidePtr[DecodePtrOffSet++] = Byte;
-						}
-					}
-				}
+			void DecodeVerifiedSFFSpriteToBMP() {
+				DecodeVerifiedSprite(kSpriteBinary, DecideBinary.data(), DecideBinary.size());
 			}
 
 			void WriteFlippedDecideToBMP() {
 				unsigned char* PixelPtr = BMPBinary.data() + kBMPPixelOffBits;
+				const unsigned char* const DecidePtr = (kDecodedBinary ? kDecodedBinary : DecideBinary.data());
+				const int32_t Left = (kTrimmed ? kTrimRect.X : 0);
+				const int32_t Top = (kTrimmed ? kTrimRect.Y : 0);
+				if (BMPBytesPerLine() == 0) { return; } // 0̍s͏ނ̂Ȃ(̈mۂȂ)
 
-				for (int32_t y = Ymax() - 1; y >= 0; --y) {
-					std::memcpy(PixelPtr, &DecideBinary[static_cast<size_t>(y) * BytesPerLine()], BytesPerLine());
-					PixelPtr += BytesPerLine();
+				for (int32_t y = Top + BMPHeight() - 1; y >= Top; --y) {
+					std::memcpy(PixelPtr, DecidePtr + static_cast<size_t>(y) * BytesPerLine() + Left, BMPBytesPerLine());
+					PixelPtr += BMPBytesPerLine();
 
 					if (BMPScanlinePadding() > 0) {
 						std::memset(PixelPtr, 0x00, BMPScanlinePadding());
@@ -539,21 +1238,97 @@ namespace SAELib {
 				AssignPaletteToBMP();
 
 				// SFFf[^BMP`ɕ
-				DecodeSFFSpriteToBMP();
+				if (kDecodedBinary) {
+					// ς
+				}
+				else if (kVerified) {
+					DecodeVerifiedSFFSpriteToBMP();
+				}
+				else {
+					DecodeSFFSpriteToBMP();
+				}
 
 				// f[^㉺]ď
 				WriteFlippedDecideToBMP();
 			}
 
 		public:
-			T_BuildBMPBinary(const unsigned char* const SpriteBinary, const unsigned char* const PaletteBinary, ksize_t SpriteBinarySize)
-				: kSpriteBinary(SpriteBinary), kPaletteBinary(PaletteBinary), kSpriteBinarySize(SpriteBinarySize)
+			// DecodedBinaryDecodeVerifiedSpriteőSs𕜌f
+			// ScratchResourcenullptȑꍇ͊̃\[Xgp
+			T_BuildBMPBinary(const unsigned char* const SpriteBinary, const unsigned char* const PaletteBinary, ksize_t SpriteBinarySize, bool Verified = false, const T_OpaqueRect* const TrimRect = nullptr, const unsigned char* const DecodedBinary = nullptr, std::pmr::memory_resource* const ScratchResource = nullptr)
+				: kSpriteBinary(SpriteBinary), kPaletteBinary(PaletteBinary), kSpriteBinarySize(SpriteBinarySize), kVerified(Verified), kTrimmed(TrimRect != nullptr), kTrimRect(ClampTrimRect(SpriteBinary, TrimRect)), kDecodedBinary(DecodedBinary)
+				, BMPBinary(ScratchResource ? ScratchResource : std::pmr::get_default_resource())
+				, DecideBinary(ScratchResource ? ScratchResource : std::pmr::get_default_resource())
 			{
 				BuildBMPBinary();
 			}
 
-			[[nodiscard]] const std::vector<unsigned char>& vecdata() const noexcept {
-				return BMPBinary; 
+			// Ss𕜌ꍇ̃oCg
+			[[nodiscard]] inline static size_t DecodedSize(const unsigned char* const SpriteBinary) noexcept {
+				return static_cast<size_t>(DecodeBinary::UInt16LE(&SpriteBinary[66])) * static_cast<uint16_t>(1 + DecodeBinary::UInt16LE(&SpriteBinary[10]));
+			}
+
+			// ؂̉摜f[^p(͈͊O̓ǂݏsȂ)
+			// [RowssBytesPerLinePʂŕ
+			inline static void DecodeSprite(const unsigned char* const SpriteBinary, ksize_t SpriteBinarySize, unsigned char* const Decide, uint16_t Rows) {
+				const uint16_t kBytesPerLine = DecodeBinary::UInt16LE(&SpriteBinary[66]);
+				ksize_t SpriteBinaryOffSet = SFFFormat::kSpriteBinaryPixelOffbits; // 摜f[^Jnʒu
+				for (int32_t y = 0; y < Rows; ++y) {
+					unsigned char* DecidePtr = Decide + y * kBytesPerLine;
+					uint16_t DecodePtrOffSet = 0;
+
+					while (DecodePtrOffSet < kBytesPerLine && SpriteBinaryOffSet < SpriteBinarySize) {
+						uint8_t Byte = SpriteBinary[SpriteBinaryOffSet++];
+						if (SpriteBinaryOffSet >= SpriteBinarySize) { // zO̒l΍
+							T_ErrorHandle::Instance().SetError(ErrorMessage::CheckBuildBMPBinaryData);
+							break;
+						}
+
+						// RLEk߂̔
+						if ((Byte & 0xC0) == 0xC0) {
+							int32_t FillCount = Byte & 0x3F; // ݐ
+							uint8_t FillValue = SpriteBinary[SpriteBinaryOffSet++]; // ޒl
+							int32_t CopyFillCount = (FillCount <= kBytesPerLine - DecodePtrOffSet ? FillCount : kBytesPerLine - DecodePtrOffSet); // ۂ̏ݐ
+							std::memset(DecidePtr + DecodePtrOffSet, FillValue, CopyFillCount);
+							DecodePtrOffSet += CopyFillCount;
+						}
+						else {
+							DecidePtr[DecodePtrOffSet++] = Byte;
+						}
+					}
+				}
+			}
+
+			// T_VerifySpriteBinaryŌ؍ς݂̉摜f[^p
+			// essŉߕsȂI邱Ƃۏ؂Ă̂őSs1{̘ÄƂĕ
+			inline static void DecodeVerifiedSprite(const unsigned char* const SpriteBinary, unsigned char* const Decide, size_t DecideSize) noexcept {
+				const unsigned char* SpritePtr = SpriteBinary + SFFFormat::kSpriteBinaryPixelOffbits;
+				unsigned char* DecidePtr = Decide;
+				unsigned char* const DecideEndPtr = DecidePtr + DecideSize;
+
+				while (DecidePtr < DecideEndPtr) {
+					uint8_t Byte = *SpritePtr++;
+					if ((Byte & 0xC0) == 0xC0) {
+						int32_t FillCount = Byte & 0x3F;
+						std::memset(DecidePtr, *SpritePtr++, FillCount);
+						DecidePtr += FillCount;
+					}
+					else {
+						*DecidePtr++ = Byte;
+					}
+				}
+			}
+
+			// Ɨ̈Ƃ͕ʂɌĂяo֕ԂzƂĕ
+			[[nodiscard]] std::vector<unsigned char> vecdata() const {
+				return std::vector<unsigned char>(BMPBinary.begin(), BMPBinary.end());
+			}
+
+			// \zς݂BMPf[^̃pbĝ݂ւ(sNZf[^͍ĕȂ)
+			[[nodiscard]] inline static bool ChangePalette(std::vector<unsigned char>& BMPBinaryData, const unsigned char* const PaletteBinary) noexcept {
+				if (BMPBinaryData.size() < kBMPPixelOffBits || BMPBinaryData[0] != 'B' || BMPBinaryData[1] != 'M') { return false; }
+				AssignPaletteToBMP(BMPBinaryData.data(), PaletteBinary);
+				return true;
 			}
 
 			[[nodiscard]] const unsigned char* const data() const noexcept {
@@ -565,10 +1340,275 @@ namespace SAELib {
 			}
 		};
 
-		// XvCgXg̉摜ԍ̏d`FbN݊mF
-		struct T_UnorderedMap {
+		// pbgWJ̃sNZ`(̃oCg)
+		enum class T_PixelFormat : uint8_t {
+			RGBA8888,			// R,G,B,A (pbgԍ0A=0ŐF͕ێ)
+			BGRA8888,			// B,G,R,A (pbgԍ0A=0ŐF͕ێ)
+			PremultipliedRGBA,	// At@Zς݂R,G,B,A (pbgԍ0͑S0)
+		};
+
+		// pbgԍ̉f32bitJ[֓WJ
+		// 1xpbg256F̕ϊ\ɂĂAfƂɕ\
+		struct T_ExpandPalette {
+			using T_Table = std::array<uint32_t, 256>;
+
+			// pbgԍ0͓AȊO͕s
+			inline static void BuildTable(const unsigned char* const PaletteBinary, T_PixelFormat Format, T_Table& Table) noexcept {
+				for (int32_t i = 0; i < 256; ++i) {
+					const unsigned char R = PaletteBinary[i * 3 + 0];
+					const unsigned char G = PaletteBinary[i * 3 + 1];
+					const unsigned char B = PaletteBinary[i * 3 + 2];
+					const unsigned char A = (i == 0 ? 0x00 : 0xFF);
+					unsigned char Color[4] = { R, G, B, A };
+					if (Format == T_PixelFormat::BGRA8888) {
+						Color[0] = B;
+						Color[2] = R;
+					}
+					else if (Format == T_PixelFormat::PremultipliedRGBA && A == 0x00) {
+						Color[0] = Color[1] = Color[2] = 0x00;
+					}
+					std::memcpy(&Table[i], Color, sizeof(Color));
+				}
+			}
+
+			// AVX2Lȏꍇ8fMU[ŕ\A[1f
+			inline static void Expand(const unsigned char* const IndexPixel, size_t NumPixel, const T_Table& Table, unsigned char* const Dest) noexcept {
+				size_t i = 0;
+#if defined(__AVX2__)
+				const int* const TablePtr = reinterpret_cast<const int*>(Table.data());
+				for (; i + 8 <= NumPixel; i += 8) {
+					const __m256i Index = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(IndexPixel + i)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dest + i * 4), _mm256_i32gather_epi32(TablePtr, Index, 4));
+				}
+#endif
+				for (; i < NumPixel; ++i) {
+					std::memcpy(Dest + i * 4, &Table[IndexPixel[i]], 4);
+				}
+			}
+		};
+
+		// f[^\Ƃ̃gp
+		struct T_MemoryUsage {
+		private:
+			size_t Size_ = 0;
+			size_t Capacity_ = 0;
+
+		public:
+			/**
+			* @brief gp̃oCg擾
+			*
+			* @i[Ăvf݂̂̃oCgԂ܂
+			*
+			* @return size_t Size gp̃oCg
+			*/
+			size_t Size() const noexcept { return Size_; }
+
+			/**
+			* @brief mۍς݂̃oCg擾
+			*
+			* @gp̗\̈Ǘp̗̈܂߂oCgԂ܂
+			*
+			* @return size_t Capacity mۍς݂̃oCg
+			*/
+			size_t Capacity() const noexcept { return Capacity_; }
+
+		public:
+			T_MemoryUsage() = default;
+
+			T_MemoryUsage(size_t Size, size_t Capacity) : Size_(Size), Capacity_(Capacity) {}
+
+			template<typename T, typename T_Allocator>
+			T_MemoryUsage(const std::vector<T, T_Allocator>& Vector) : Size_(sizeof(T) * Vector.size()), Capacity_(sizeof(T) * Vector.capacity()) {}
+
+			T_MemoryUsage& operator+=(const T_MemoryUsage& Other) noexcept {
+				Size_ += Other.Size_;
+				Capacity_ += Other.Capacity_;
+				return *this;
+			}
+		};
+
+		// SFFf[^̃gpʂ̓
+		struct T_MemoryReport {
+		private:
+			T_MemoryUsage SpriteList_ = {};
+			T_MemoryUsage IndexList_ = {};
+			T_MemoryUsage DataList_ = {};
+			T_MemoryUsage Sprite_ = {};
+			T_MemoryUsage Palette_ = {};
+			T_MemoryUsage SpriteNumberMap_ = {};
+			T_MemoryUsage SpriteDataMap_ = {};
+			T_MemoryUsage CollisionMask_ = {};
+			T_MemoryUsage DecodedSprite_ = {};
+			size_t RawSpriteSize_ = 0;
+			size_t RawPaletteSize_ = 0;
+			size_t SpriteDedupSavedSize_ = 0;
+			size_t PaletteDedupSavedSize_ = 0;
+			size_t NumDecodedDedupSprite_ = 0;
+
+		public:
+			/**
+			* @brief 摜f[^ꗗ̃gpʂ擾
+			*
+			* @return const MemoryUsage& SpriteList d摜f[^̈ʒu
+			*/
+			const T_MemoryUsage& SpriteList() const noexcept { return SpriteList_; }
+
+			/**
+			* @brief 摜ƃpbg̑gݍ킹ꗗ̃gpʂ擾
+			*
+			* @return const MemoryUsage& IndexList 摜f[^ƃpbgf[^̑gݍ킹
+			*/
+			const T_MemoryUsage& IndexList() const noexcept { return IndexList_; }
+
+			/**
+			* @brief 摜ԍꗗ̃gpʂ擾
+			*
+			* @return const MemoryUsage& DataList 摜ԍƎW
+			*/
+			const T_MemoryUsage& DataList() const noexcept { return DataList_; }
+
+			/**
+			* @brief 摜f[^̃gpʂ擾
+			*
+			* @return const MemoryUsage& Sprite d摜f[^(PCX){
+			*/
+			const T_MemoryUsage& Sprite() const noexcept { return Sprite_; }
+
+			/**
+			* @brief pbgf[^̃gpʂ擾
+			*
+			* @return const MemoryUsage& Palette dpbgf[^{
+			*/
+			const T_MemoryUsage& Palette() const noexcept { return Palette_; }
+
+			/**
+			* @brief 摜ԍp̃nbVe[ũgpʂ擾
+			*
+			* @mۍς݂̃oCg̓m[hƃoPbg܂ފTZlł(WCu̎ɂقȂ܂)
+			*
+			* @return const MemoryUsage& SpriteNumberMap 摜ԍp̃nbVe[u
+			*/
+			const T_MemoryUsage& SpriteNumberMap() const noexcept { return SpriteNumberMap_; }
+
+			/**
+			* @brief 摜ƃpbg̑gݍ킹p̃nbVe[ũgpʂ擾
+			*
+			* @mۍς݂̃oCg̓m[hƃoPbg܂ފTZlł(WCu̎ɂقȂ܂)
+			*
+			* @return const MemoryUsage& SpriteDataMap gݍ킹p̃nbVe[u
+			*/
+			const T_MemoryUsage& SpriteDataMap() const noexcept { return SpriteDataMap_; }
+
+			/**
+			* @brief 蔻p}XÑLbṼgpʂ擾
+			*
+			* @ς݂̃}XN݂̂܂܂܂
+			*
+			* @return const MemoryUsage& CollisionMask 蔻p}XÑLbV
+			*/
+			const T_MemoryUsage& CollisionMask() const noexcept { return CollisionMask_; }
+
+			/**
+			* @brief ǂ݂f̃LbṼgpʂ擾
+			*
+			* @SFF::Prefetchŕς݂̉摜݂̂܂܂܂
+			*
+			* @return const MemoryUsage& DecodedSprite ǂ݂f̃LbV
+			*/
+			const T_MemoryUsage& DecodedSprite() const noexcept { return DecodedSprite_; }
+
+			/**
+			* @brief Ŝ̃gpʂ擾
+			*
+			* @return MemoryUsage Total SẴf[^\̍v
+			*/
+			T_MemoryUsage Total() const noexcept {
+				T_MemoryUsage Total = SpriteList_;
+				Total += IndexList_;
+				Total += DataList_;
+				Total += Sprite_;
+				Total += Palette_;
+				Total += SpriteNumberMap_;
+				Total += SpriteDataMap_;
+				Total += CollisionMask_;
+				Total += DecodedSprite_;
+				return Total;
+			}
+
+			/**
+			* @brief dỎ摜f[^̃oCg擾
+			*
+			* @ǂݍ݌t@CɎۂɑ݂摜f[^(PCX)̃oCgԂ܂BN摜̓t@Cɉ摜f[^Ȃߊ܂݂܂
+			*
+			* @SFF::Evictŉ摜f[^̉摜ASFFBuilderŒǉ摜AAttachSharedŐڑf[^͊܂݂܂
+			*
+			* @return size_t RawSpriteSize dỎ摜f[^̃oCg
+			*/
+			size_t RawSpriteSize() const noexcept { return RawSpriteSize_; }
+
+			/**
+			* @brief dÕpbgf[^̃oCg擾
+			*
+			* @ǂݍ݌t@CɎۂɑ݂pbgf[^̃oCgԂ܂BLpbg̉摜̓t@CɃpbgf[^Ȃߊ܂݂܂
+			*
+			* @LoadPaletteŒǉpbg͊܂݂܂
+			*
+			* @return size_t RawPaletteSize dÕpbgf[^̃oCg
+			*/
+			size_t RawPaletteSize() const noexcept { return RawPaletteSize_; }
+
+			/**
+			* @brief 摜f[^̏dō팸oCg擾
+			*
+			* @RawSpriteSizeẢ摜f[^dĊi[oCglł
+			*
+			* @return size_t SpriteDedupSavedSize 팸oCg
+			*/
+			size_t SpriteDedupSavedSize() const noexcept { return SpriteDedupSavedSize_; }
+
+			/**
+			* @brief pbgf[^̏dō팸oCg擾
+			*
+			* @RawPaletteSizeAǂݍݎɏdĊi[pbgf[^̃oCglł
+			*
+			* @return size_t PaletteDedupSavedSize 팸oCg
+			*/
+			size_t PaletteDedupSavedSize() const noexcept { return PaletteDedupSavedSize_; }
+
+			/**
+			* @brief ̉fɂdœ摜擾
+			*
+			* @SFFConfig::SetDecodedSpriteDedupLȏꍇɁAoCg͈قȂ邪fv1̉摜f[^ɓ摜Ԃ܂
+			*
+			* @ō팸oCgSpriteDedupSavedSizeɊ܂܂܂
+			*
+			* @return size_t NumDecodedDedupSprite 摜
+			*/
+			size_t NumDecodedDedupSprite() const noexcept { return NumDecodedDedupSprite_; }
+
+			void SpriteList(const T_MemoryUsage& value) noexcept { SpriteList_ = value; }
+			void IndexList(const T_MemoryUsage& value) noexcept { IndexList_ = value; }
+			void DataList(const T_MemoryUsage& value) noexcept { DataList_ = value; }
+			void Sprite(const T_MemoryUsage& value) noexcept { Sprite_ = value; }
+			void Palette(const T_MemoryUsage& value) noexcept { Palette_ = value; }
+			void SpriteNumberMap(const T_MemoryUsage& value) noexcept { SpriteNumberMap_ = value; }
+			void SpriteDataMap(const T_MemoryUsage& value) noexcept { SpriteDataMap_ = value; }
+			void CollisionMask(const T_MemoryUsage& value) noexcept { CollisionMask_ = value; }
+			void DecodedSprite(const T_MemoryUsage& value) noexcept { DecodedSprite_ = value; }
+			void RawSpriteSize(size_t value) noexcept { RawSpriteSize_ = value; }
+			void NumDecodedDedupSprite(size_t value) noexcept { NumDecodedDedupSprite_ = value; }
+			void RawPaletteSize(size_t value) noexcept { RawPaletteSize_ = value; }
+			void SpriteDedupSavedSize(size_t value) noexcept { SpriteDedupSavedSize_ = value; }
+			void PaletteDedupSavedSize(size_t value) noexcept { PaletteDedupSavedSize_ = value; }
+
+		public:
+			T_MemoryReport() = default;
+		};
+
+		// XvCgXg̉摜ԍ̏d`FbN݊mF
+		struct T_UnorderedMap {
 		private:
-			std::unordered_map<int32_t, int32_t> UnorderedMap = {};
+			std::pmr::unordered_map<int32_t, int32_t> UnorderedMap = {};
 
 		public:
 			void Register(int32_t value) {
@@ -586,25 +1626,33 @@ namespace SAELib {
 		public:
 			T_UnorderedMap() = default;
 
-			[[nodiscard]] int32_t find(int32_t input) {
+			explicit T_UnorderedMap(std::pmr::memory_resource* const Resource) : UnorderedMap(Resource) {}
+
+			// ̓Rs[Ɠ\[Xgp
+			T_UnorderedMap(const T_UnorderedMap& Other) : UnorderedMap(Other.UnorderedMap, Other.UnorderedMap.get_allocator()) {}
+			T_UnorderedMap(T_UnorderedMap&&) = default;
+			T_UnorderedMap& operator=(const T_UnorderedMap&) = default;
+			T_UnorderedMap& operator=(T_UnorderedMap&&) = default;
+
+			[[nodiscard]] int32_t find(int32_t input) const {
 				auto it = UnorderedMap.find(input);
 				if (it != UnorderedMap.end()) { return it->second; }
 				return -1;
 			}
-			[[nodiscard]] int32_t find(int32_t value1, int32_t value2) {
+			[[nodiscard]] int32_t find(int32_t value1, int32_t value2) const {
 				return find(Convert::EncodeIntHalf(value1, value2));
 			}
-			[[nodiscard]] int32_t find(ksize_t value1, ksize_t value2) {
+			[[nodiscard]] int32_t find(ksize_t value1, ksize_t value2) const {
 				return find(Convert::EncodeIntHalf(static_cast<int32_t>(value1), static_cast<int32_t>(value2)));
 			}
 
-			[[nodiscard]] bool exist(int32_t value) {
+			[[nodiscard]] bool exist(int32_t value) const {
 				return find(value) >= 0;
 			}
-			[[nodiscard]] bool exist(int32_t value1, int32_t value2) {
+			[[nodiscard]] bool exist(int32_t value1, int32_t value2) const {
 				return find(value1, value2) >= 0;
 			}
-			[[nodiscard]] bool exist(ksize_t value1, ksize_t value2) {
+			[[nodiscard]] bool exist(ksize_t value1, ksize_t value2) const {
 				return find(static_cast<int32_t>(value1), static_cast<int32_t>(value2)) >= 0;
 			}
 
@@ -627,593 +1675,4468 @@ namespace SAELib {
 			[[nodiscard]] ksize_t size() const noexcept {
 				return static_cast<ksize_t>(UnorderedMap.size());
 			}
+
+			// m[h͗vfƑÕNAoPbg̓|C^1ƂĊTZ
+			[[nodiscard]] T_MemoryUsage MemoryUsage() const noexcept {
+				using value_type = std::pmr::unordered_map<int32_t, int32_t>::value_type;
+				constexpr size_t kNodeSize = sizeof(value_type) + sizeof(void*) * 2;
+				return T_MemoryUsage(sizeof(value_type) * UnorderedMap.size(), kNodeSize * UnorderedMap.size() + sizeof(void*) * UnorderedMap.bucket_count());
+			}
 		};
 
-		// 摜pbg̃oCif[^Ǘ
-		struct T_SFFBinaryData {
+		// 摜f[^̊i[
+		// TCỸ`NPʂŊmۂAi[ς݂̃f[^̃AhXړȂ(Ċmۂɂ郁̈ꎞIȔ{)
+		// ̓`NL(i[ς݂̃f[^͕ύXȂ)
+		struct T_SpriteArena {
 		private:
-			struct T_SpriteList {
-			private:
-				const ksize_t kSpriteStart;
-				const ksize_t kSpriteSize;
-			public:
-				[[nodiscard]] ksize_t SpriteStart() const noexcept { return kSpriteStart; }
-				[[nodiscard]] ksize_t SpriteSize() const noexcept { return kSpriteSize; }
-
-				T_SpriteList(ksize_t SpriteStart, ksize_t SpriteSize)
-					: kSpriteStart(SpriteStart), kSpriteSize(SpriteSize) {
-				}
-			};
+			inline static constexpr ksize_t kChunkSize = 256 * 1024;
 
-			struct T_IndexList {
-			private:
-				const ksize_t kSpriteListIndex;
-				const ksize_t kPaletteIndex;
-			public:
-				[[nodiscard]] ksize_t SpriteListIndex() const noexcept { return kSpriteListIndex; }
-				[[nodiscard]] ksize_t PaletteIndex() const noexcept { return kPaletteIndex; }
-				[[nodiscard]] ksize_t PaletteStart() const noexcept { return kPaletteIndex * SFFFormat::kSFFPaletteSize; }
-
-				T_IndexList(ksize_t SpriteListIndex, ksize_t PaletteIndex)
-					: kSpriteListIndex(SpriteListIndex), kPaletteIndex(PaletteIndex) {
-				}
-			};
-
-			struct T_DataList {
-			private:
-				const ksize_t kIndexListNumber;	// zIndex
-				const int32_t kSpriteAxis;		// axisXY(-32768`32767) axisX(65535) axisY(65535)
-				const int32_t kSpriteNumber;	// groupNo(65535) imageNo(65535)
-			public:
-				[[nodiscard]] ksize_t IndexListNumber() const noexcept { return kIndexListNumber; }
-				[[nodiscard]] int32_t AxisX() const noexcept { return Convert::DecodeSpriteAxisX(kSpriteAxis); }
-				[[nodiscard]] int32_t AxisY() const noexcept { return Convert::DecodeSpriteAxisY(kSpriteAxis); }
-				[[nodiscard]] int32_t GroupNo() const noexcept { return Convert::DecodeSpriteGroupNo(kSpriteNumber); }
-				[[nodiscard]] int32_t ImageNo() const noexcept { return Convert::DecodeSpriteImageNo(kSpriteNumber); }
-
-				T_DataList(ksize_t IndexListNumber, int32_t AxisX, int32_t AxisY, int32_t GroupNo, int32_t ImageNo) noexcept
-					: kIndexListNumber(IndexListNumber)
-					, kSpriteAxis(Convert::EncodeSpriteAxis(AxisX, AxisY))
-					, kSpriteNumber(Convert::EncodeIntHalf(GroupNo, ImageNo)) {
-				}
+			struct T_Chunk {
+				std::shared_ptr<unsigned char[]> Data;
+				ksize_t Capacity;
+				ksize_t Size;
 			};
 
-			std::vector<T_SpriteList> SpriteList_ = {};
-			std::vector<T_IndexList> IndexList_ = {};
-			std::vector<T_DataList> DataList_ = {};
-			std::vector<unsigned char> Sprite_ = {};
-			std::vector<unsigned char> Palette_ = {};
-		
-		public:
-			[[nodiscard]] const std::vector<T_SpriteList>& SpriteList() const noexcept { return SpriteList_; }
-			[[nodiscard]] const std::vector<T_IndexList>& IndexList() const noexcept { return IndexList_; }
-			[[nodiscard]] const std::vector<T_DataList>& DataList() const noexcept { return DataList_; }
-			[[nodiscard]] const std::vector<unsigned char>& Sprite() const noexcept { return Sprite_; }
-			[[nodiscard]] const std::vector<unsigned char>& Palette() const noexcept { return Palette_; }
-			[[nodiscard]] const T_SpriteList& SpriteList(ksize_t index) const noexcept { return SpriteList_[index]; }
-			[[nodiscard]] const T_IndexList& IndexList(ksize_t index) const noexcept { return IndexList_[index]; }
-			[[nodiscard]] const T_DataList& DataList(ksize_t index) const noexcept { return DataList_[index]; }
-			[[nodiscard]] ksize_t NumSprite() const noexcept { return static_cast<ksize_t>(SpriteList_.size()); }
-			[[nodiscard]] ksize_t NumPalette() const noexcept { return static_cast<ksize_t>(Palette_.size()) / SFFFormat::kSFFPaletteSize; }
-
-			[[nodiscard]] const unsigned char* const Sprite(ksize_t index) const noexcept {
-				return Sprite_.data() + SpriteList_[index].SpriteStart();
+			std::pmr::memory_resource* Resource_ = std::pmr::get_default_resource();
+			std::pmr::vector<T_Chunk> ChunkList = {};
+			ksize_t Size_ = 0;
+			ksize_t OpenChunk_ = KSIZE_MAX; // ǋL̃`N(KSIZE_MAX = Ȃ)
+			std::shared_ptr<const unsigned char> SharedData_ = {}; // L̉摜f[^(ڑ̓`NgpȂ)
+
+			// `NƋL̊Ǘ̈̓\[XmۂAŌ̋Ljꂽ_œ\[X֕Ԃ
+			[[nodiscard]] std::shared_ptr<unsigned char[]> AllocateChunk(ksize_t Capacity) const {
+				std::pmr::memory_resource* const Resource = Resource_;
+				unsigned char* const Data = static_cast<unsigned char*>(Resource->allocate(Capacity, 1));
+				return std::shared_ptr<unsigned char[]>(Data, [Resource, Capacity](unsigned char* const Ptr) { Resource->deallocate(Ptr, Capacity, 1); }, std::pmr::polymorphic_allocator<unsigned char>(Resource));
 			}
 
-			[[nodiscard]] const unsigned char* const IndexList_Sprite(ksize_t index) const noexcept {
-				return Sprite(IndexList_[index].SpriteListIndex());
+			void CopyChunkList(const T_SpriteArena& Other) {
+				SharedData_ = Other.SharedData_; // L̃f[^͕Ȃ
+				ChunkList.reserve(Other.ChunkList.size());
+				for (const auto& Chunk : Other.ChunkList) {
+					// L`N̖gp̈ւ͒ǋLȂ
+					ChunkList.push_back({ Chunk.Data, Chunk.Size, Chunk.Size });
+				}
+				Size_ = Other.Size_;
 			}
 
-			[[nodiscard]] const unsigned char* const DataList_Sprite(ksize_t index) const noexcept {
-				return IndexList_Sprite(DataList_[index].IndexListNumber());
-			}
+		public:
+			T_SpriteArena() = default;
 
-			[[nodiscard]] const unsigned char* const Palette(ksize_t index) const noexcept {
-				return Palette_.data() + index * SFFFormat::kSFFPaletteSize;
+			// ړ͒ǋL̃`NȂ̏Ԃɂ
+			T_SpriteArena(T_SpriteArena&& Other) noexcept
+				: Resource_(Other.Resource_), ChunkList(std::move(Other.ChunkList)), Size_(Other.Size_), OpenChunk_(Other.OpenChunk_), SharedData_(std::move(Other.SharedData_)) {
+				Other.clear();
 			}
 
-			[[nodiscard]] const unsigned char* const IndexList_Palette(ksize_t index) const noexcept {
-				return Palette_.data() + IndexList_[index].PaletteStart();
+			T_SpriteArena& operator=(T_SpriteArena&& Other) noexcept {
+				if (this != &Other) {
+					Resource_ = Other.Resource_;
+					ChunkList = std::move(Other.ChunkList);
+					Size_ = Other.Size_;
+					OpenChunk_ = Other.OpenChunk_;
+					SharedData_ = std::move(Other.SharedData_);
+					Other.clear();
+				}
+				return *this;
 			}
 
-			[[nodiscard]] const unsigned char* const DataList_Palette(ksize_t index) const noexcept {
-				return IndexList_Palette(DataList_[index].IndexListNumber());
-			}
+			explicit T_SpriteArena(std::pmr::memory_resource* const Resource) : Resource_(Resource), ChunkList(Resource) {}
 
-			[[nodiscard]] ksize_t SpriteSize(ksize_t index) const noexcept {
-				return SpriteList_[index].SpriteSize();
+			// ̓Rs[Ɠ\[Xgp
+			T_SpriteArena(const T_SpriteArena& Other) : Resource_(Other.Resource_), ChunkList(Other.Resource_) {
+				CopyChunkList(Other);
 			}
 
-			[[nodiscard]] ksize_t IndexList_SpriteSize(ksize_t index) const noexcept {
-				return SpriteSize(IndexList_[index].SpriteListIndex());
+			T_SpriteArena& operator=(const T_SpriteArena& Other) {
+				if (this != &Other) {
+					clear();
+					CopyChunkList(Other);
+				}
+				return *this;
 			}
 
-			[[nodiscard]] ksize_t DataList_SpriteSize(ksize_t index) const noexcept {
-				return IndexList_SpriteSize(DataList_[index].IndexListNumber());
+			[[nodiscard]] const unsigned char* const data(ksize_t ChunkIndex, ksize_t Offset) const noexcept {
+				return (SharedData_ ? SharedData_.get() : ChunkList[ChunkIndex].Data.get()) + Offset;
 			}
 
-			void AddIndexList(ksize_t SpriteListIndex, ksize_t PaletteIndex) {
-				IndexList_.emplace_back(T_IndexList(SpriteListIndex, PaletteIndex));
+			// L̉摜f[^Q(DatȁL҂L̐ڑێ)
+			void attach(std::shared_ptr<const unsigned char> Data, ksize_t Size) {
+				clear();
+				SharedData_ = std::move(Data);
+				Size_ = Size;
 			}
 
-			void AddDataList(ksize_t IndexListNumber, int32_t AxisX, int32_t AxisY, int32_t GroupNo, int32_t ImageNo) {
-				DataList_.emplace_back(T_DataList(IndexListNumber, AxisX, AxisY, GroupNo, ImageNo));
+			// i[̃`ÑCfbNXԂ(`N̊i[ʒuOffset֏o)
+			// ǋL̃`NɎ܂Ȃꍇ͐V`Nmۂ
+			// `N̔傫摜͐p̃`N֊i[AǋL̃`N̖gp̈͌㑱̉摜Ɏgp
+			ksize_t push_back(const unsigned char* const Data, ksize_t Size, ksize_t& Offset) {
+				ksize_t ChunkIndex = OpenChunk_;
+				if (Size > kChunkSize / 2) {
+					ChunkIndex = static_cast<ksize_t>(ChunkList.size());
+					ChunkList.push_back({ AllocateChunk(Size), Size, 0 });
+				}
+				else if (OpenChunk_ == KSIZE_MAX || ChunkList[OpenChunk_].Capacity - ChunkList[OpenChunk_].Size < Size) {
+					ChunkIndex = OpenChunk_ = static_cast<ksize_t>(ChunkList.size());
+					ChunkList.push_back({ AllocateChunk(kChunkSize), kChunkSize, 0 });
+				}
+				T_Chunk& Chunk = ChunkList[ChunkIndex];
+				Offset = Chunk.Size;
+				std::memcpy(Chunk.Data.get() + Chunk.Size, Data, Size);
+				Chunk.Size += Size;
+				Size_ += Size;
+				return ChunkIndex;
 			}
 
-			void AddSprite(const std::vector<unsigned char>& LoadSpriteData) {
-				SpriteList_.emplace_back(T_SpriteList(static_cast<ksize_t>(Sprite_.size()), static_cast<ksize_t>(LoadSpriteData.size())));
-				Sprite_.insert(Sprite_.end(), LoadSpriteData.begin(), LoadSpriteData.end());
+			// ReleaseChunktruẽ`NĈꗗ菜(̃XibvVbgLĂꍇ́A炪j܂ŉȂ)
+			// c`ÑCfbNX́AOŎ`N̐Oɋl܂
+			void release(const std::vector<bool>& ReleaseChunk) {
+				const ksize_t OpenChunk = OpenChunk_;
+				OpenChunk_ = KSIZE_MAX;
+				ksize_t NewChunkIndex = 0;
+				for (ksize_t ChunkIndex = 0; ChunkIndex < ChunkList.size(); ++ChunkIndex) {
+					if (ChunkIndex < ReleaseChunk.size() && ReleaseChunk[ChunkIndex]) {
+						Size_ -= ChunkList[ChunkIndex].Size;
+						continue;
+					}
+					if (ChunkIndex == OpenChunk) { OpenChunk_ = NewChunkIndex; }
+					if (NewChunkIndex != ChunkIndex) { ChunkList[NewChunkIndex] = std::move(ChunkList[ChunkIndex]); }
+					++NewChunkIndex;
+				}
+				ChunkList.erase(ChunkList.begin() + NewChunkIndex, ChunkList.end());
 			}
 
-			void AddPalette(const std::array<unsigned char, SFFFormat::kSFFPaletteSize>& LoadPaletteData) {
-				Palette_.insert(Palette_.end(), LoadPaletteData.begin(), LoadPaletteData.end());
+			[[nodiscard]] ksize_t NumChunk() const noexcept {
+				return static_cast<ksize_t>(ChunkList.size());
 			}
 
-		public:
-			T_SFFBinaryData() = default;
-
-			void reserve(ksize_t NumImage, ksize_t FileSize, ksize_t PaletteSize) {
-				SpriteList_.reserve(NumImage);
-				IndexList_.reserve(NumImage);
-				DataList_.reserve(NumImage);
-				Sprite_.reserve(FileSize);
-				Palette_.reserve(PaletteSize);
+			// Xg[~Oǂݍݒ̓`Nꗗ̍Ċmۂ֎~邽߁A摜mۂĂ
+			void reserve(ksize_t NumChunk) {
+				ChunkList.reserve(NumChunk);
 			}
 
 			void clear() {
-				SpriteList_.clear();
-				IndexList_.clear();
-				DataList_.clear();
-				Sprite_.clear();
-				Palette_.clear();
+				ChunkList.clear();
+				SharedData_.reset();
+				Size_ = 0;
+				OpenChunk_ = KSIZE_MAX;
 			}
 
+			// ǋL̃`N̖gp̈(i[ς݂̃AhXς邽ߓǂݍ݊̂ݎgp)
 			void shrink_to_fit() {
-				SpriteList_.shrink_to_fit();
-				IndexList_.shrink_to_fit();
-				DataList_.shrink_to_fit();
-				// Sprite_.shrink_to_fit(); vZX2{ɒˏオ̂Ŗ
-				Palette_.shrink_to_fit();
+				ChunkList.shrink_to_fit();
+				if (OpenChunk_ == KSIZE_MAX || ChunkList[OpenChunk_].Size == ChunkList[OpenChunk_].Capacity) { return; }
+				T_Chunk& Chunk = ChunkList[OpenChunk_];
+				std::shared_ptr<unsigned char[]> Data = AllocateChunk(Chunk.Size);
+				std::memcpy(Data.get(), Chunk.Data.get(), Chunk.Size);
+				Chunk.Data = std::move(Data);
+				Chunk.Capacity = Chunk.Size;
 			}
 
 			[[nodiscard]] bool empty() const noexcept {
-				return SpriteList_.empty() && IndexList_.empty() && DataList_.empty() && Sprite_.empty() && Palette_.empty();
+				return ChunkList.empty() && !SharedData_;
 			}
 
 			[[nodiscard]] ksize_t size() const noexcept {
-				return static_cast<ksize_t>(Sprite_.size() + Palette_.size());
+				return Size_;
+			}
+
+			// mۍς݂̃oCg̓`N̖gp̈ƃ`Nꗗ܂(L̃f[^͊܂܂Ȃ)
+			[[nodiscard]] T_MemoryUsage MemoryUsage() const noexcept {
+				if (SharedData_) { return T_MemoryUsage(Size_, 0); }
+				size_t Capacity = sizeof(T_Chunk) * ChunkList.capacity();
+				for (const auto& Chunk : ChunkList) { Capacity += Chunk.Capacity; }
+				return T_MemoryUsage(Size_, Capacity);
 			}
 		};
 
-		// SFFǂݍݎ̃wb_[i[
-		struct T_LoadSFFHeader {
+		// s(pbgԍ0ȊO)1f1rbgŕ\蔻p}XN
+		// s̋`݂̂ێAes64rbgPʂō[̉fŉʃrbgƂĊi[
+		struct T_CollisionMask {
 		private:
-			const std::string kFileName = {};
-			const std::string kFilePath = {};
-			const uintmax_t kFileSize = 0;
-			std::ifstream File = {};
-			unsigned char buffer[33] = {};
-			const bool kCheckError = false;
-			// 0`11 ʎq("ElecbyteSpr")
-			// 12` C
-			// 33` ]
-			// 36` Rg
-
-			[[nodiscard]] const std::string EnsureSffExtension(const std::filesystem::path& FileName) const {
-				std::filesystem::path FixedFileName = FileName;
-				if (FixedFileName.extension() != SFFFormat::kExtension) {
-					if (!FixedFileName.extension().empty()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidSFFExtension);
-					}
-					FixedFileName.replace_extension(SFFFormat::kExtension);
+			int32_t X_ = 0;	// 摜ォ̃}XN̈ʒu
+			int32_t Y_ = 0;
+			int32_t Width_ = 0;
+			int32_t Height_ = 0;
+			int32_t WordsPerRow_ = 0;
+			std::vector<uint64_t> Bits_ = {};
+
+			[[nodiscard]] uint64_t* Row(int32_t y) noexcept { return Bits_.data() + static_cast<size_t>(y) * WordsPerRow_; }
+			[[nodiscard]] const uint64_t* Row(int32_t y) const noexcept { return Bits_.data() + static_cast<size_t>(y) * WordsPerRow_; }
+
+			// s[Begin, End)̉f̃rbg64rbgPʂł܂Ƃ߂ėĂ
+			static void SetBits(uint64_t* const RowPtr, int32_t Begin, int32_t End) noexcept {
+				while (Begin < End) {
+					const int32_t Shift = Begin & 63;
+					const int32_t Count = (std::min)(64 - Shift, End - Begin);
+					RowPtr[Begin >> 6] |= (Count == 64 ? ~uint64_t(0) : ((uint64_t(1) << Count) - 1)) << Shift;
+					Begin += Count;
 				}
-				return FixedFileName.string();
 			}
 
-			[[nodiscard]] const std::string FindFilePathDown(const std::string& FilePath) const {
-				T_FilePathSystem SFFFolder;
-				if (!FilePath.empty()) {
-					SFFFolder.SetPath(FilePath);
-					if (SFFFolder.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::LoadSFFInvalidPath);
+			// sBitPosԖڂ̉f64fo(͈͊Ỏf0)
+			[[nodiscard]] static uint64_t ExtractWord(const uint64_t* const RowPtr, int32_t WordsPerRow, int32_t BitPos) noexcept {
+				if (BitPos <= -64) { return 0; }
+				if (BitPos < 0) { return RowPtr[0] << -BitPos; }
+				const int32_t Word = BitPos >> 6;
+				const int32_t Shift = BitPos & 63;
+				if (Word >= WordsPerRow) { return 0; }
+				uint64_t Value = RowPtr[Word] >> Shift;
+				if (Shift && Word + 1 < WordsPerRow) { Value |= RowPtr[Word + 1] << (64 - Shift); }
+				return Value;
+			}
+
+			// RLE̘AƂɃrbg𗧂Ă邽߁AsNZf[^𕜌ɐł
+			// ؂̉摜ɂgp邽DecodeSFFSpriteToBMPƓlɔ͈͂mFȂH
+			void BuildMask(const unsigned char* const SpriteBinary, ksize_t SpriteBinarySize) {
+				const int32_t BytesPerLine = DecodeBinary::UInt16LE(&SpriteBinary[66]);
+				ksize_t SpriteBinaryOffSet = SFFFormat::kSpriteBinaryPixelOffbits;
+				for (int32_t y = 0; y < Y_ + Height_; ++y) {
+					int32_t DecodePtrOffSet = 0;
+					while (DecodePtrOffSet < BytesPerLine && SpriteBinaryOffSet < SpriteBinarySize) {
+						uint8_t Byte = SpriteBinary[SpriteBinaryOffSet++];
+						int32_t FillCount = 1;
+						if ((Byte & 0xC0) == 0xC0) {
+							if (SpriteBinaryOffSet >= SpriteBinarySize) { return; }
+							FillCount = (std::min)(Byte & 0x3F, BytesPerLine - DecodePtrOffSet);
+							Byte = SpriteBinary[SpriteBinaryOffSet++];
+						}
+						if (Byte && y >= Y_) {
+							const int32_t Begin = (std::max)(DecodePtrOffSet, X_);
+							const int32_t End = (std::min)(DecodePtrOffSet + FillCount, X_ + Width_);
+							if (Begin < End) { SetBits(Row(y - Y_), Begin - X_, End - X_); }
+						}
+						DecodePtrOffSet += FillCount;
 					}
 				}
-				if (FilePath.empty() || SFFFolder.ErrorCode() && !T_Config::Instance().SFFSearchPath().empty()) {
-					SFFFolder.SetPath(T_Config::Instance().SFFSearchPath());
-					if (SFFFolder.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::SFFSearchInvalidPath);
+			}
+
+		public:
+			/**
+			* @brief }XN̍[̍W擾
+			*
+			* @return int32_t X 摜ォ̃}XN̍[̍W (SpriteData::OpaqueXƓ)
+			*/
+			int32_t X() const noexcept { return X_; }
+
+			/**
+			* @brief }XN̏[̍W擾
+			*
+			* @return int32_t Y 摜ォ̃}XN̏[̍W (SpriteData::OpaqueYƓ)
+			*/
+			int32_t Y() const noexcept { return Y_; }
+
+			/**
+			* @brief }XN̕擾
+			*
+			* @return int32_t Width }XN̕ (SpriteData::OpaqueWidthƓ)
+			*/
+			int32_t Width() const noexcept { return Width_; }
+
+			/**
+			* @brief }XN̍擾
+			*
+			* @return int32_t Height }XN̍ (SpriteData::OpaqueHeightƓ)
+			*/
+			int32_t Height() const noexcept { return Height_; }
+
+			/**
+			* @brief }XN̑݊mF
+			*
+			* @sȉfȂ摜ƃ_~[f[^̃}XN͋ɂȂ܂
+			*
+			* @return bool 茋 (false = sȉfFtrue = }XN)
+			*/
+			bool empty() const noexcept { return Bits_.empty(); }
+
+			/**
+			* @brief wW̉fs𔻒
+			*
+			* @param int32_t x 摜ォXW
+			* @param int32_t y 摜ォYW
+			* @return bool 茋 (false = ܂͔͈͊OFtrue = s)
+			*/
+			bool Opaque(int32_t x, int32_t y) const noexcept {
+				x -= X_;
+				y -= Y_;
+				if (x < 0 || y < 0 || x >= Width_ || y >= Height_) { return false; }
+				return (Row(y)[x >> 6] >> (x & 63)) & 1;
+			}
+
+			/**
+			* @brief ̃}XNƂ̏dȂ𔻒
+			*
+			* @2̉摜̕sȉf1łdȂ邩64fPʂ̃rbgZŔ肵܂
+			*
+			* @ʒu͎g̉摜_Ƃ̉摜̍WŎw肵܂
+			*
+			* @param const CollisionMask& Other 肷鑊̃}XN
+			* @param int32_t OffsetX ̉摜XW
+			* @param int32_t OffsetY ̉摜YW
+			* @return bool 茋 (false = dȂȂFtrue = dȂ肠)
+			*/
+			bool Overlap(const T_CollisionMask& Other, int32_t OffsetX, int32_t OffsetY) const noexcept {
+				if (empty() || Other.empty()) { return false; }
+
+				// ̃}XN̈ʒug̉摜̍Wn֕ϊAdȂ͈݂͂̂𑖍
+				const int32_t OtherX = Other.X_ + OffsetX;
+				const int32_t OtherY = Other.Y_ + OffsetY;
+				const int32_t Left = (std::max)(X_, OtherX);
+				const int32_t Right = (std::min)(X_ + Width_, OtherX + Other.Width_);
+				const int32_t Top = (std::max)(Y_, OtherY);
+				const int32_t Bottom = (std::min)(Y_ + Height_, OtherY + Other.Height_);
+				if (Left >= Right || Top >= Bottom) { return false; }
+
+				const int32_t BeginWord = (Left - X_) >> 6;
+				const int32_t EndWord = (Right - X_ + 63) >> 6;
+				for (int32_t y = Top; y < Bottom; ++y) {
+					const uint64_t* const RowPtr = Row(y - Y_);
+					const uint64_t* const OtherRowPtr = Other.Row(y - OtherY);
+					for (int32_t Word = BeginWord; Word < EndWord; ++Word) {
+						if (RowPtr[Word] & ExtractWord(OtherRowPtr, Other.WordsPerRow_, X_ + Word * 64 - OtherX)) { return true; }
 					}
 				}
-				const std::filesystem::path AbsolutePath = (std::filesystem::exists(SFFFolder.Path()) ? SFFFolder.Path() : std::filesystem::canonical(std::filesystem::current_path()));
+				return false;
+			}
 
-				for (const auto& entry : std::filesystem::recursive_directory_iterator(
-					AbsolutePath, std::filesystem::directory_options::skip_permission_denied)) {
-					if (!entry.is_regular_file()) { continue; }
-					if (entry.path().filename() == kFileName) {
-						return entry.path().string();
-					}
+			/**
+			* @brief }XÑgpʂ擾
+			*
+			* @return MemoryUsage MemoryUsage }XÑrbg̃gp
+			*/
+			T_MemoryUsage MemoryUsage() const noexcept { return T_MemoryUsage(Bits_); }
+
+			T_CollisionMask() = default;
+
+			T_CollisionMask(const unsigned char* const SpriteBinary, ksize_t SpriteBinarySize, const T_OpaqueRect& OpaqueRect)
+				: X_(OpaqueRect.X), Y_(OpaqueRect.Y), Width_(OpaqueRect.Width), Height_(OpaqueRect.Height), WordsPerRow_((OpaqueRect.Width + 63) / 64)
+			{
+				if (Width_ == 0 || Height_ == 0) { return; }
+				Bits_.resize(static_cast<size_t>(WordsPerRow_) * Height_, 0);
+				BuildMask(SpriteBinary, SpriteBinarySize);
+			}
+		};
+
+		// ǂ݂ŕf(BMP\z̕ȗ)
+		struct T_DecodedSprite {
+		private:
+			std::vector<unsigned char> Binary_ = {}; // [̍sBytesPerLinePʂőSs
+
+		public:
+			[[nodiscard]] const unsigned char* data() const noexcept { return Binary_.data(); }
+			[[nodiscard]] T_MemoryUsage MemoryUsage() const noexcept { return T_MemoryUsage(Binary_); }
+
+			// ؍ς݂̉摜f[^p
+			T_DecodedSprite(const unsigned char* const SpriteBinary) : Binary_(T_BuildBMPBinary::DecodedSize(SpriteBinary)) {
+				T_BuildBMPBinary::DecodeVerifiedSprite(SpriteBinary, Binary_.data(), Binary_.size());
+			}
+		};
+
+		// SpriteListPʂ̐f[^̃LbV(蔻p}XNEǂ݂f)
+		// QƎɐA摜f[^摜ŋL
+		template<typename T_Value>
+		struct T_SpriteCache {
+		private:
+			mutable std::mutex Mutex_ = {};
+			std::vector<std::shared_ptr<const T_Value>> ValueList_ = {};
+
+		public:
+			T_SpriteCache() = default;
+
+			T_SpriteCache(const T_SpriteCache& Other) {
+				std::lock_guard<std::mutex> Lock(Other.Mutex_);
+				ValueList_ = Other.ValueList_; // ɕύXȂߋL
+			}
+
+			T_SpriteCache& operator=(const T_SpriteCache& Other) {
+				if (this != &Other) {
+					std::scoped_lock Lock(Mutex_, Other.Mutex_);
+					ValueList_ = Other.ValueList_;
 				}
+				return *this;
+			}
 
-				T_ErrorHandle::Instance().SetError(ErrorMessage::SFFFileNotFound);
-				return {};
+			// ǂݍݒւO̎QƂĂȂf[^Ԃł̂ݎgp
+			T_SpriteCache(T_SpriteCache&& Other) noexcept : ValueList_(std::move(Other.ValueList_)) {}
+
+			T_SpriteCache& operator=(T_SpriteCache&& Other) noexcept {
+				ValueList_.swap(Other.ValueList_);
+				return *this;
 			}
 
-			[[nodiscard]] bool CheckFileSize() const {
-				if (kFileSize <= UINT32_MAX) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::SFFFileSizeOver);
-				return true;
+			// ̓bN̊OōsAɐꂽꍇ͐Ɋi[ꂽgp
+			template<typename T_Build>
+			const T_Value& get(ksize_t index, T_Build&& Build) {
+				{
+					std::lock_guard<std::mutex> Lock(Mutex_);
+					if (index < ValueList_.size() && ValueList_[index]) { return *ValueList_[index]; }
+				}
+				auto Value = std::make_shared<const T_Value>(Build());
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				if (index >= ValueList_.size()) { ValueList_.resize(static_cast<size_t>(index) + 1); }
+				if (!ValueList_[index]) { ValueList_[index] = std::move(Value); }
+				return *ValueList_[index];
 			}
-			[[nodiscard]] bool CheckFilePath() const {
-				if (!FilePath().empty()) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::EmptySFFFilePath);
-				return true;
+
+			// ς݂̏ꍇ̂ݎ擾(͍sȂ)
+			[[nodiscard]] std::shared_ptr<const T_Value> find(ksize_t index) const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				return (index < ValueList_.size() ? ValueList_[index] : nullptr);
 			}
-			[[nodiscard]] bool CheckFileOpen() {
-				File.open(FilePath(), std::ios::binary);
-				if (File.is_open()) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::OpenSFFFileFailed);
-				return true;
+
+			void clear() {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				ValueList_.clear();
 			}
 
-			[[nodiscard]] bool CheckSFFFormat() {
-				// t@Cǂݎ肪ނ̂ňꂩɂ܂Ƃ߂
-				File.read(reinterpret_cast<char*>(&buffer), sizeof(buffer));
+			// w肵摜̐ς݃f[^j(Qƒ̃f[^͎QƂȂ܂ŕێ)
+			void erase(ksize_t index) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				if (index < ValueList_.size()) { ValueList_[index].reset(); }
+			}
 
-				if (Signature() != SFFFormat::kSignature) { 
-					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidSFFSignature);
-					return true;
+			[[nodiscard]] T_MemoryUsage MemoryUsage() const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				T_MemoryUsage Usage(ValueList_);
+				for (const auto& Value : ValueList_) {
+					if (Value) { Usage += Value->MemoryUsage(); }
 				}
-				if (Version() == SFFFormat::kSFFV2Version) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::UnsupportedSFFv2Version);
-					return true;
+				return Usage;
+			}
+		};
+
+		using T_CollisionMaskCache = T_SpriteCache<T_CollisionMask>;
+		using T_DecodedSpriteCache = T_SpriteCache<T_DecodedSprite>;
+
+		// 摜pbg̃oCif[^Ǘ
+		struct T_SFFBinaryData {
+		private:
+			struct T_SpriteList {
+			private:
+				const ksize_t kChunkIndex;	// T_SpriteArenã`N
+				const ksize_t kSpriteStart;	// `N̊Jnʒu
+				const ksize_t kSpriteSize;
+				const bool kVerified;		// T_VerifySpriteBinary̌،
+				const T_OpaqueRect kOpaqueRect;	// T_VerifySpriteBinaryŋ߂s̋`
+				const uint32_t kFileOffset;	// ǂݍ݌t@C̉摜f[^̈ʒu(0 = ǂݍ݌Ȃ)
+				uint32_t FileByteSize_ = 0;	// ǂݍ݌t@Cł̉摜f[^ɂ܂Ƃ߂ꂽ摜f[^̃oCg̍v
+			public:
+				[[nodiscard]] ksize_t ChunkIndex() const noexcept { return kChunkIndex; }
+				[[nodiscard]] ksize_t SpriteStart() const noexcept { return kSpriteStart; }
+				[[nodiscard]] ksize_t SpriteSize() const noexcept { return kSpriteSize; }
+				[[nodiscard]] bool Verified() const noexcept { return kVerified; }
+				[[nodiscard]] const T_OpaqueRect& OpaqueRect() const noexcept { return kOpaqueRect; }
+				[[nodiscard]] uint32_t FileOffset() const noexcept { return kFileOffset; }
+				[[nodiscard]] uint32_t FileByteSize() const noexcept { return FileByteSize_; }
+				void AddFileByteSize(uint32_t value) noexcept { FileByteSize_ += value; }
+				[[nodiscard]] bool Resident() const noexcept { return kChunkIndex != KSIZE_MAX; } // ς݂̉摜̓`NȂ
+
+				T_SpriteList(ksize_t ChunkIndex, ksize_t SpriteStart, ksize_t SpriteSize, bool Verified, const T_OpaqueRect& OpaqueRect, uint32_t FileOffset = 0)
+					: kChunkIndex(ChunkIndex), kSpriteStart(SpriteStart), kSpriteSize(SpriteSize), kVerified(Verified), kOpaqueRect(OpaqueRect), kFileOffset(FileOffset) {
 				}
-				if (Version() == SFFFormat::kSFFV2_1Version) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::UnsupportedSFFv2_1Version);
-					return true;
+
+				// i[݂̂ύX(KSIZE_MAX = ς)
+				[[nodiscard]] T_SpriteList Relocate(ksize_t ChunkIndex, ksize_t SpriteStart) const noexcept {
+					T_SpriteList Sprite(ChunkIndex, SpriteStart, kSpriteSize, kVerified, kOpaqueRect, kFileOffset);
+					Sprite.FileByteSize_ = FileByteSize_;
+					return Sprite;
 				}
-				if (Version() != SFFFormat::kSFFV1Version || 
-					SubHeaderStart() != SFFFormat::kSubHeaderStart ||
-					FileLength() != SFFFormat::kFileLength) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::BrokenSFFFile);
-					return true;
+			};
+
+			struct T_IndexList {
+			private:
+				const ksize_t kSpriteListIndex;
+				const ksize_t kPaletteIndex;
+			public:
+				[[nodiscard]] ksize_t SpriteListIndex() const noexcept { return kSpriteListIndex; }
+				[[nodiscard]] ksize_t PaletteIndex() const noexcept { return kPaletteIndex; }
+				[[nodiscard]] ksize_t PaletteStart() const noexcept { return kPaletteIndex * SFFFormat::kSFFPaletteSize; }
+
+				T_IndexList(ksize_t SpriteListIndex, ksize_t PaletteIndex)
+					: kSpriteListIndex(SpriteListIndex), kPaletteIndex(PaletteIndex) {
 				}
+			};
 
-				return false;
-			}
+			struct T_DataList {
+			private:
+				const ksize_t kIndexListNumber;	// zIndex
+				const int32_t kSpriteAxis;		// axisXY(-32768`32767) axisX(65535) axisY(65535)
+				const int32_t kSpriteNumber;	// groupNo(65535) imageNo(65535)
+			public:
+				[[nodiscard]] ksize_t IndexListNumber() const noexcept { return kIndexListNumber; }
+				[[nodiscard]] int32_t SpriteNumber() const noexcept { return kSpriteNumber; }
+				[[nodiscard]] int32_t AxisX() const noexcept { return Convert::DecodeSpriteAxisX(kSpriteAxis); }
+				[[nodiscard]] int32_t AxisY() const noexcept { return Convert::DecodeSpriteAxisY(kSpriteAxis); }
+				[[nodiscard]] int32_t GroupNo() const noexcept { return Convert::DecodeSpriteGroupNo(kSpriteNumber); }
+				[[nodiscard]] int32_t ImageNo() const noexcept { return Convert::DecodeSpriteImageNo(kSpriteNumber); }
 
-			[[nodiscard]] bool CheckFileError() { // CheckFileOpen  CheckSFFFormat ̏Ŏs
-				return CheckFileSize() || CheckFilePath() || CheckFileOpen() || CheckSFFFormat();
-			}
+				T_DataList(ksize_t IndexListNumber, int32_t AxisX, int32_t AxisY, int32_t GroupNo, int32_t ImageNo) noexcept
+					: kIndexListNumber(IndexListNumber)
+					, kSpriteAxis(Convert::EncodeSpriteAxis(AxisX, AxisY))
+					, kSpriteNumber(Convert::EncodeIntHalf(GroupNo, ImageNo)) {
+				}
+			};
 
+			std::pmr::vector<T_SpriteList> SpriteList_ = {};
+			std::pmr::vector<T_IndexList> IndexList_ = {};
+			std::pmr::vector<T_DataList> DataList_ = {};
+			T_SpriteArena Sprite_ = {};
+			std::pmr::vector<unsigned char> Palette_ = {};
+			mutable T_CollisionMaskCache CollisionMask_ = {}; // f[^̃LbV͊̃\[Xgp
+			mutable T_DecodedSpriteCache DecodedSprite_ = {};
+			ksize_t NumDecodedDedupSprite_ = 0; // ̉fɂdœ摜
+			uint64_t FilePaletteSize_ = 0; // ǂݍ݌t@C̃pbgf[^̃oCg
+			ksize_t NumFilePalette_ = 0; // ǂݍ݌t@CdĊi[pbg
+		
 		public:
-			[[nodiscard]] const std::string& FileName() const noexcept { return kFileName; }
-			[[nodiscard]] const std::string& FilePath() const noexcept { return kFilePath; }
-			[[nodiscard]] ksize_t FileSize() const noexcept { return static_cast<ksize_t>(kFileSize); }
-			[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(buffer), SFFFormat::kSignature.size()); }
-			[[nodiscard]] uint32_t Version() const noexcept { return DecodeBinary::UInt32BE(&buffer[12]); }
-			[[nodiscard]] uint32_t NumGroups() const noexcept { return DecodeBinary::UInt32LE(&buffer[16]); }
-			[[nodiscard]] uint32_t NumImages() const noexcept { return DecodeBinary::UInt32LE(&buffer[20]); }
-			[[nodiscard]] uint32_t SubHeaderStart() const noexcept { return DecodeBinary::UInt32LE(&buffer[24]); }
-			[[nodiscard]] uint32_t FileLength() const noexcept { return DecodeBinary::UInt32LE(&buffer[28]); }
-			[[nodiscard]] unsigned char SharedPal() const noexcept { return buffer[32]; }
-			[[nodiscard]] bool CheckError() const noexcept { return kCheckError; }
+			[[nodiscard]] const std::pmr::vector<T_SpriteList>& SpriteList() const noexcept { return SpriteList_; }
+			[[nodiscard]] const std::pmr::vector<T_IndexList>& IndexList() const noexcept { return IndexList_; }
+			[[nodiscard]] const std::pmr::vector<T_DataList>& DataList() const noexcept { return DataList_; }
+			[[nodiscard]] const std::pmr::vector<unsigned char>& Palette() const noexcept { return Palette_; }
+			[[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return Palette_.get_allocator().resource(); }
+			[[nodiscard]] const T_SpriteList& SpriteList(ksize_t index) const noexcept { return SpriteList_[index]; }
+			[[nodiscard]] const T_IndexList& IndexList(ksize_t index) const noexcept { return IndexList_[index]; }
+			[[nodiscard]] const T_DataList& DataList(ksize_t index) const noexcept { return DataList_[index]; }
+			[[nodiscard]] ksize_t NumSprite() const noexcept { return static_cast<ksize_t>(SpriteList_.size()); }
+			[[nodiscard]] ksize_t NumPalette() const noexcept { return static_cast<ksize_t>(Palette_.size()) / SFFFormat::kSFFPaletteSize; }
+			[[nodiscard]] ksize_t NumDecodedDedupSprite() const noexcept { return NumDecodedDedupSprite_; }
 
-		public:
-			T_LoadSFFHeader(const std::string& FileName, const std::string& FilePath)
-				: kFileName(EnsureSffExtension(FileName)), kFilePath(FindFilePathDown(FilePath))
-				, kFileSize(kFilePath.empty() ? 0 : std::filesystem::file_size(kFilePath)), kCheckError(CheckFileError()) {
+			// ς݂̉摜nullptrԂ
+			[[nodiscard]] const unsigned char* const Sprite(ksize_t index) const noexcept {
+				if (!SpriteList_[index].Resident()) { return nullptr; }
+				return Sprite_.data(SpriteList_[index].ChunkIndex(), SpriteList_[index].SpriteStart());
 			}
 
-			void seekg(std::streampos& _Pos, std::ios_base::seekdir _Way = std::ios::beg) {
-				File.seekg(_Pos, _Way);
+			[[nodiscard]] const unsigned char* const IndexList_Sprite(ksize_t index) const noexcept {
+				return Sprite(IndexList_[index].SpriteListIndex());
 			}
-			void seekg(uint32_t _Pos, std::ios_base::seekdir _Way = std::ios::beg) {
-				File.seekg(_Pos, _Way);
+
+			[[nodiscard]] const unsigned char* const DataList_Sprite(ksize_t index) const noexcept {
+				return IndexList_Sprite(DataList_[index].IndexListNumber());
 			}
 
-			void read(char* _Str, std::streamsize _Count) {
-				File.read(_Str, _Count);
+			[[nodiscard]] const unsigned char* const Palette(ksize_t index) const noexcept {
+				return Palette_.data() + index * SFFFormat::kSFFPaletteSize;
 			}
 
-			[[nodiscard]] std::streampos tellg() {
-				return File.tellg();
+			[[nodiscard]] const unsigned char* const IndexList_Palette(ksize_t index) const noexcept {
+				return Palette_.data() + IndexList_[index].PaletteStart();
 			}
-		};
 
-		// SFFǂݍݎ̃Tuwb_[i[
-		struct T_LoadSFFSubHeader {
-		private:
-			unsigned char buffer[19] = {}; // v̏̂݊i[
-			// 0`18 C
-			// 19` t@CƂĂꍇ(])
-			// 32` 摜f[^ + pbgf[^(0 or 768 Byte)
-			int32_t DuplicationCount_ = 0;
-			T_LoadSFFHeader& File;
-			std::vector<unsigned char> LoadSpriteData = {};
-			std::array<unsigned char, SFFFormat::kSFFPaletteSize> LoadPaletteData = {};
+			[[nodiscard]] const unsigned char* const DataList_Palette(ksize_t index) const noexcept {
+				return IndexList_Palette(DataList_[index].IndexListNumber());
+			}
 
-			void AddDuplicationCount() {
-				++DuplicationCount_;
+			[[nodiscard]] ksize_t SpriteSize(ksize_t index) const noexcept {
+				return SpriteList_[index].SpriteSize();
 			}
 
-			void InitLoadSFFSubHeader() {
-				File.seekg(File.SubHeaderStart());
+			[[nodiscard]] ksize_t IndexList_SpriteSize(ksize_t index) const noexcept {
+				return SpriteSize(IndexList_[index].SpriteListIndex());
 			}
 
-			[[nodiscard]] bool CheckReadError() { // f[^̖ɓBorAhXsȒl
-				return !NextAddress() || NextAddress() < File.tellg();
+			[[nodiscard]] ksize_t DataList_SpriteSize(ksize_t index) const noexcept {
+				return IndexList_SpriteSize(DataList_[index].IndexListNumber());
 			}
 
-			[[nodiscard]] bool ReadSubHeader() {
-				constexpr unsigned long long SkipSize = SFFFormat::kFileLength - sizeof(buffer);
-				File.read(reinterpret_cast<char*>(&buffer), sizeof(buffer));
-				File.seekg(SkipSize, std::ios::cur); // f[^]XLbv(XvCgoCif[^܂őΈړ)
-				return CheckReadError();
+			[[nodiscard]] bool SpriteVerified(ksize_t index) const noexcept {
+				return SpriteList_[index].Verified();
 			}
 
-		public:
-			[[nodiscard]] uint32_t NextAddress() const noexcept { return DecodeBinary::UInt32LE(&buffer[0]); }
-			[[nodiscard]] uint32_t PCXDataSize() const noexcept { return DecodeBinary::UInt32LE(&buffer[4]); }
-			[[nodiscard]] uint16_t AxisX() const noexcept { return DecodeBinary::UInt16LE(&buffer[8]); }
-			[[nodiscard]] uint16_t AxisY() const noexcept { return DecodeBinary::UInt16LE(&buffer[10]); }
-			[[nodiscard]] uint16_t GroupNo() const noexcept { return DecodeBinary::UInt16LE(&buffer[12]); }
-			[[nodiscard]] uint16_t ImageNo() const noexcept { return DecodeBinary::UInt16LE(&buffer[14]); }
-			[[nodiscard]] uint16_t SpriteIndex() const noexcept { return DecodeBinary::UInt16LE(&buffer[16]); }
-			[[nodiscard]] unsigned char SharedPal() const noexcept { return buffer[18]; }
-			[[nodiscard]] bool CheckError() { return false; } // vȂ̂ŕۗ
-			[[nodiscard]] int32_t DuplicationCount() const noexcept { return DuplicationCount_; }
+			[[nodiscard]] bool SpriteResident(ksize_t index) const noexcept {
+				return SpriteList_[index].Resident();
+			}
 
-		public:
-			T_LoadSFFSubHeader(T_LoadSFFHeader& LoadSFFHeader) : File(LoadSFFHeader) {
-				InitLoadSFFSubHeader();
+			[[nodiscard]] bool IndexList_SpriteResident(ksize_t index) const noexcept {
+				return SpriteResident(IndexList_[index].SpriteListIndex());
 			}
 
-			[[nodiscard]] bool ReadSpriteBinary(int32_t LoadNo, T_UnorderedMap& SpriteNumberUMap, T_UnorderedMap& SpriteDataUMap, T_SFFBinaryData& SFFBinaryData) {
-				if (ReadSubHeader()) { return true; }
+			[[nodiscard]] bool DataList_SpriteResident(ksize_t index) const noexcept {
+				return IndexList_SpriteResident(DataList_[index].IndexListNumber());
+			}
 
-				// 擾摜ԍd
-				if (SpriteNumberUMap.exist(GroupNo(), ImageNo())) {
-					AddDuplicationCount();
-					T_ErrorHandle::Instance().SetError(ErrorMessage::DuplicateSpriteNumber, GroupNo(), ImageNo());
-					File.seekg(NextAddress());
-					return false;
-				}
+			[[nodiscard]] bool IndexList_SpriteVerified(ksize_t index) const noexcept {
+				return SpriteVerified(IndexList_[index].SpriteListIndex());
+			}
 
-				SpriteNumberUMap.Register(GroupNo(), ImageNo());
-				ksize_t SpriteListIndex = 0;
-				ksize_t PaletteListIndex = 0;
-				ksize_t IndexListNumber = 0;
+			[[nodiscard]] bool DataList_SpriteVerified(ksize_t index) const noexcept {
+				return IndexList_SpriteVerified(DataList_[index].IndexListNumber());
+			}
 
-				// 摜f[^
-				if (PCXDataSize()) {
-					bool FoundSpriteData = false;
-					bool FoundPaletteData = false;
-					const bool SharedPal_ = (!LoadNo ? false : !!SharedPal()); // 擪摜͌ŗLpbgƂĈ
+			[[nodiscard]] const T_OpaqueRect& SpriteOpaqueRect(ksize_t index) const noexcept {
+				return SpriteList_[index].OpaqueRect();
+			}
 
-					// ŗLpbgȂ摜f[^768Byte(pbgf[^)O
-					LoadSpriteData.resize(static_cast<size_t>(PCXDataSize()) - (!SharedPal_ ? SFFFormat::kSFFPaletteSize : 0));
+			[[nodiscard]] const T_OpaqueRect& IndexList_SpriteOpaqueRect(ksize_t index) const noexcept {
+				return SpriteOpaqueRect(IndexList_[index].SpriteListIndex());
+			}
 
-					// 摜f[^ꎞۑ
-					File.read(reinterpret_cast<char*>(LoadSpriteData.data()), LoadSpriteData.size());
+			[[nodiscard]] const T_CollisionMask& SpriteCollisionMask(ksize_t index) const {
+				static const T_CollisionMask kEmptyCollisionMask;
+				if (!SpriteResident(index)) { return kEmptyCollisionMask; }
+				return CollisionMask_.get(index, [&]() { return T_CollisionMask(Sprite(index), SpriteSize(index), SpriteOpaqueRect(index)); });
+			}
 
-					if (SharedPal_) {
-						FoundPaletteData = true;
-						// 摜ԍ(0,0)̏ꍇ擪摜̃pbgKp
-						// łȂΑO摜̃pbgp
-						if (GroupNo() == 0 && ImageNo() == 0) {
-							PaletteListIndex = 0;
-						}
-						else {
-							PaletteListIndex = SFFBinaryData.IndexList(SFFBinaryData.DataList().back().IndexListNumber()).PaletteIndex();
-						}
-					}
-					else {
-						// pbgf[^ꎞۑ
-						File.read(reinterpret_cast<char*>(LoadPaletteData.data()), SFFFormat::kSFFPaletteSize);
+			[[nodiscard]] const T_CollisionMask& IndexList_SpriteCollisionMask(ksize_t index) const {
+				return SpriteCollisionMask(IndexList_[index].SpriteListIndex());
+			}
 
-						// pbgf[^d`FbN
-						for (PaletteListIndex = 0; PaletteListIndex < SFFBinaryData.NumPalette(); ++PaletteListIndex) {
-							// ̃pbgf[^̏ꍇ̓CfbNXw
-							if (!std::memcmp(SFFBinaryData.Palette(PaletteListIndex), LoadPaletteData.data(), SFFFormat::kSFFPaletteSize)) {
-								FoundPaletteData = true;
-								break;
-							}
-						}
+			// ǂݍς݂̉f(̏ꍇ͋)
+			[[nodiscard]] std::shared_ptr<const T_DecodedSprite> SpriteDecoded(ksize_t index) const {
+				return DecodedSprite_.find(index);
+			}
 
-						// VKpbg̏ꍇ̓pbgf[^i[
-						if (!FoundPaletteData) {
-							PaletteListIndex = SFFBinaryData.NumPalette();
-							SFFBinaryData.AddPalette(LoadPaletteData);
-						}
-					}
+			[[nodiscard]] std::shared_ptr<const T_DecodedSprite> IndexList_SpriteDecoded(ksize_t index) const {
+				return SpriteDecoded(IndexList_[index].SpriteListIndex());
+			}
 
-					// 摜f[^d`FbN
-					for (SpriteListIndex = 0; SpriteListIndex < SFFBinaryData.NumSprite(); ++SpriteListIndex) {
-						// ̉摜f[^̏ꍇ̓CfbNXw
-						if (SFFBinaryData.SpriteSize(SpriteListIndex) == LoadSpriteData.size() && !std::memcmp(SFFBinaryData.Sprite(SpriteListIndex), LoadSpriteData.data(), LoadSpriteData.size())) {
-							FoundSpriteData = true;
-							break;
-						}
+			// f𕜌ăLbV(؍ς݂̉摜̂)
+			void WarmSprite(ksize_t index) const {
+				if (!SpriteVerified(index) || !SpriteResident(index)) { return; }
+				DecodedSprite_.get(index, [&]() { return T_DecodedSprite(Sprite(index)); });
+			}
+
+			// 擪w萔܂ł̃f[^Xg`T(Xg[~Oǂݍݒ̌p)
+			[[nodiscard]] int32_t FindDataList(int32_t GroupNo, int32_t ImageNo, ksize_t Begin, ksize_t End) const noexcept {
+				const int32_t SpriteNumber = Convert::EncodeIntHalf(GroupNo, ImageNo);
+				for (ksize_t index = Begin; index < End; ++index) {
+					if (DataList_[index].SpriteNumber() == SpriteNumber) { return static_cast<int32_t>(index); }
+				}
+				return -1;
+			}
+
+			// f[^Xg̃O[v𐔂
+			[[nodiscard]] int32_t CountGroup() const {
+				std::vector<int32_t> GroupList = {};
+				GroupList.reserve(DataList_.size());
+				for (const T_DataList& Data : DataList_) { GroupList.push_back(Data.GroupNo()); }
+				std::sort(GroupList.begin(), GroupList.end());
+				return static_cast<int32_t>(std::unique(GroupList.begin(), GroupList.end()) - GroupList.begin());
+			}
+
+			// ʃf[^̃f[^XgƎWE摜f[^Epbgf[^v邩
+			[[nodiscard]] bool EqualDataList(ksize_t index, const T_SFFBinaryData& Other, ksize_t OtherIndex) const noexcept {
+				const T_DataList& Data = DataList_[index];
+				const T_DataList& OtherData = Other.DataList_[OtherIndex];
+				if (Data.AxisX() != OtherData.AxisX() || Data.AxisY() != OtherData.AxisY()) { return false; }
+				if (DataList_SpriteSize(index) != Other.DataList_SpriteSize(OtherIndex)) { return false; }
+				if (!DataList_SpriteResident(index) || !Other.DataList_SpriteResident(OtherIndex)) { return false; } // ς݂̉摜͔rłȂߕύXƂĈ
+				return !std::memcmp(DataList_Sprite(index), Other.DataList_Sprite(OtherIndex), DataList_SpriteSize(index))
+					&& !std::memcmp(DataList_Palette(index), Other.DataList_Palette(OtherIndex), SFFFormat::kSFFPaletteSize);
+			}
+
+			// pbgf[^̃CfbNX(݂ȂNumPaletteԂ)
+			[[nodiscard]] ksize_t FindPalette(const unsigned char* const PaletteData) const noexcept {
+				for (ksize_t PaletteIndex = 0; PaletteIndex < NumPalette(); ++PaletteIndex) {
+					if (!std::memcmp(Palette(PaletteIndex), PaletteData, SFFFormat::kSFFPaletteSize)) { return PaletteIndex; }
+				}
+				return NumPalette();
+			}
+
+			[[nodiscard]] bool AllSpriteVerified() const noexcept {
+				for (const auto& SpriteList : SpriteList_) {
+					if (!SpriteList.Verified()) { return false; }
+				}
+				return true;
+			}
+
+			[[nodiscard]] bool AllSpriteResident() const noexcept {
+				for (const auto& SpriteList : SpriteList_) {
+					if (!SpriteList.Resident()) { return false; }
+				}
+				return true;
+			}
+
+			// Keepfalsẻ摜f[^(ǂݍ݌̂Ȃ摜͉Ȃ)
+			// 摜܂ރ`N݂̂A`NɎc摜͐V`Nֈڂ
+			void EvictSprite(const std::vector<bool>& Keep) {
+				std::vector<bool> ReleaseChunk(Sprite_.NumChunk(), false);
+				for (ksize_t index = 0; index < NumSprite(); ++index) {
+					const T_SpriteList& Sprite = SpriteList_[index];
+					if (Sprite.Resident() && !Keep[index] && Sprite.FileOffset()) { ReleaseChunk[Sprite.ChunkIndex()] = true; }
+				}
+				if (std::find(ReleaseChunk.begin(), ReleaseChunk.end(), true) == ReleaseChunk.end()) { return; }
+
+				// `N͈ꗗ菜邽߁Aړ̃`ÑCfbNX֕tւ
+				// (Vmۂ`N͖ɒǉ邽߁A`N̑Oɋl܂)
+				std::vector<ksize_t> NumReleaseChunk(ReleaseChunk.size() + 1, 0); // wCfbNXOŎ`N̐
+				for (ksize_t ChunkIndex = 0; ChunkIndex < ReleaseChunk.size(); ++ChunkIndex) {
+					NumReleaseChunk[ChunkIndex + 1] = NumReleaseChunk[ChunkIndex] + (ReleaseChunk[ChunkIndex] ? 1 : 0);
+				}
+				const auto NewChunkIndex = [&NumReleaseChunk](ksize_t ChunkIndex) {
+					return ChunkIndex - NumReleaseChunk[(std::min)(static_cast<size_t>(ChunkIndex), NumReleaseChunk.size() - 1)];
+				};
 
+				std::pmr::vector<T_SpriteList> NewSpriteList(resource());
+				NewSpriteList.reserve(SpriteList_.size());
+				for (ksize_t index = 0; index < NumSprite(); ++index) {
+					const T_SpriteList& Sprite = SpriteList_[index];
+					if (!Sprite.Resident()) {
+						NewSpriteList.emplace_back(Sprite);
 					}
-					// VK摜̏ꍇ͉摜f[^i[
-					if (!FoundSpriteData) {
-						SFFBinaryData.AddSprite(LoadSpriteData);
+					else if (!ReleaseChunk[Sprite.ChunkIndex()]) {
+						NewSpriteList.emplace_back(Sprite.Relocate(NewChunkIndex(Sprite.ChunkIndex()), Sprite.SpriteStart()));
 					}
-
-					// 摜ƃpbg̑gݍ킹VK̏ꍇCfbNXXg֓o^
-					if (!FoundPaletteData || !FoundSpriteData || !SpriteDataUMap.exist(SpriteListIndex, PaletteListIndex)) {
-						SFFBinaryData.AddIndexList(SpriteListIndex, PaletteListIndex);
-						SpriteDataUMap.Register(SpriteListIndex, PaletteListIndex);
-						IndexListNumber = static_cast<ksize_t>(SFFBinaryData.IndexList().size()) - 1;
+					else if (Keep[index] || !Sprite.FileOffset()) {
+						ksize_t SpriteStart = 0;
+						const ksize_t ChunkIndex = Sprite_.push_back(this->Sprite(index), Sprite.SpriteSize(), SpriteStart);
+						NewSpriteList.emplace_back(Sprite.Relocate(NewChunkIndex(ChunkIndex), SpriteStart));
 					}
 					else {
-						IndexListNumber = SpriteDataUMap.find(SpriteListIndex, PaletteListIndex);
+						NewSpriteList.emplace_back(Sprite.Relocate(KSIZE_MAX, 0));
+						CollisionMask_.erase(index);
+						DecodedSprite_.erase(index);
 					}
 				}
-				else { // PCXDataȂȂRs[̃XvCgCfbNXw
-					IndexListNumber = SFFBinaryData.DataList(SpriteIndex() - DuplicationCount()).IndexListNumber();
+				Sprite_.release(ReleaseChunk);
+				SpriteList_.swap(NewSpriteList); // \[XmۂĂ邽ߌł
+
+				// \[Xw肵ꍇ͉\[Xł܂Ƃ߂čsÔ߁Ak̂߂̍Ċmۂ͍sȂ
+				if (resource() == std::pmr::get_default_resource()) { Sprite_.shrink_to_fit(); }
+			}
+
+			// Restoretruẻς݂̉摜f[^ǂݍ݌i[
+			// Read(t@C̈ʒu, 摜f[^TCYmۍς݂̊i[)󂯎Aǂݍ݂̐ۂԂ
+			// ǂݍ񂾉摜f[^͌؂A،ʂs̋`ǂݍݎƈقȂꍇ͎s
+			// (؍ς݂ƂĈ摜͋E`FbNȗĕ邽߁A؂ĂȂf[^i[Ȃ)
+			template <class Function>
+			[[nodiscard]] bool RestoreSprite(const std::vector<bool>& Restore, Function&& Read) {
+				std::vector<unsigned char> LoadSpriteData = {};
+				std::pmr::vector<T_SpriteList> NewSpriteList(resource());
+				NewSpriteList.reserve(SpriteList_.size());
+				for (ksize_t index = 0; index < NumSprite(); ++index) {
+					const T_SpriteList& Sprite = SpriteList_[index];
+					if (Sprite.Resident() || !Restore[index]) {
+						NewSpriteList.emplace_back(Sprite);
+						continue;
+					}
+					LoadSpriteData.resize(Sprite.SpriteSize());
+					if (!Read(Sprite.FileOffset(), LoadSpriteData)) { return false; }
+					const T_VerifySpriteBinary VerifySpriteBinary(LoadSpriteData.data(), Sprite.SpriteSize());
+					if (VerifySpriteBinary.Verified() != Sprite.Verified() || !(VerifySpriteBinary.OpaqueRect() == Sprite.OpaqueRect())) { return false; }
+					ksize_t SpriteStart = 0;
+					const ksize_t ChunkIndex = Sprite_.push_back(LoadSpriteData.data(), Sprite.SpriteSize(), SpriteStart);
+					NewSpriteList.emplace_back(Sprite.Relocate(ChunkIndex, SpriteStart));
 				}
-				SFFBinaryData.AddDataList(IndexListNumber, AxisX(), AxisY(), GroupNo(), ImageNo());
+				SpriteList_.swap(NewSpriteList); // \[XmۂĂ邽ߌł
+				if (resource() == std::pmr::get_default_resource()) { Sprite_.shrink_to_fit(); }
+				return true;
+			}
 
-				File.seekg(NextAddress());
+			void AddIndexList(ksize_t SpriteListIndex, ksize_t PaletteIndex) {
+				IndexList_.emplace_back(T_IndexList(SpriteListIndex, PaletteIndex));
+			}
 
-				return false;
+			void AddDataList(ksize_t IndexListNumber, int32_t AxisX, int32_t AxisY, int32_t GroupNo, int32_t ImageNo) {
+				DataList_.emplace_back(T_DataList(IndexListNumber, AxisX, AxisY, GroupNo, ImageNo));
 			}
-		};
 
-		// C
-		struct T_SFFData {
-		private:
-			int32_t NumGroup_ = 0;
-			int32_t NumImage_ = 0;
-			std::string FileName_ = {};
-			T_UnorderedMap SpriteNumberUMap = {};
-			T_UnorderedMap SpriteDataUMap = {};
-			T_SFFBinaryData SFFBinaryData = {};
+			// FileOffset͓ǂݍ݌t@C̉摜f[^̈ʒu(摜̍ēǂݍ݂ɎgpA0 = ǂݍ݌Ȃ)
+			void AddSprite(const std::vector<unsigned char>& LoadSpriteData, uint32_t FileOffset = 0) {
+				const T_VerifySpriteBinary VerifySpriteBinary(LoadSpriteData.data(), static_cast<ksize_t>(LoadSpriteData.size()));
+				AddSprite(LoadSpriteData, VerifySpriteBinary.Verified(), VerifySpriteBinary.OpaqueRect(), FileOffset);
+			}
 
-			void NumGroup(int32_t value) noexcept { NumGroup_ = value; }
-			void NumImage(int32_t value) noexcept { NumImage_ = value; }
-			void FileName(const std::string& value) noexcept { FileName_ = value; }
+			// ؍ς݂̌ʂpŊi[(ēǂݍݎ̕ύX̂Ȃ摜p)
+			void AddSprite(const std::vector<unsigned char>& LoadSpriteData, bool Verified, const T_OpaqueRect& OpaqueRect, uint32_t FileOffset = 0) {
+				AddSprite(LoadSpriteData.data(), static_cast<ksize_t>(LoadSpriteData.size()), Verified, OpaqueRect, FileOffset);
+			}
 
-			void ReserveSpriteData(T_LoadSFFHeader& LoadSFFHeader) {
-				const ksize_t kNumImage = LoadSFFHeader.NumImages();
-				const ksize_t kFileSize = LoadSFFHeader.FileSize();
-				const ksize_t kPaletteSize = kNumImage * SFFFormat::kSFFPaletteSize;
+			void AddSprite(const unsigned char* SpriteBinary, ksize_t SpriteSize, bool Verified, const T_OpaqueRect& OpaqueRect, uint32_t FileOffset = 0) {
+				ksize_t SpriteStart = 0;
+				const ksize_t ChunkIndex = Sprite_.push_back(SpriteBinary, SpriteSize, SpriteStart);
+				SpriteList_.emplace_back(T_SpriteList(ChunkIndex, SpriteStart, SpriteSize, Verified, OpaqueRect, FileOffset));
+			}
 
-				SpriteNumberUMap.reserve(kNumImage);
-				SpriteDataUMap.reserve(kNumImage);
-				SFFBinaryData.reserve(kNumImage, kFileSize, kPaletteSize);
+			// L̉摜f[^QƂĊi[(SpriteStart͋L̉摜f[^̈̐擪̈ʒu)
+			void AttachSprite(std::shared_ptr<const unsigned char> SpriteData, ksize_t Size) {
+				Sprite_.attach(std::move(SpriteData), Size);
 			}
 
-			void shrink_to_fit() {
-				SpriteNumberUMap.shrink_to_fit();
-				SpriteDataUMap.shrink_to_fit();
-				SFFBinaryData.shrink_to_fit();
+			void AddSharedSprite(ksize_t SpriteStart, ksize_t SpriteSize, bool Verified, const T_OpaqueRect& OpaqueRect) {
+				SpriteList_.emplace_back(T_SpriteList(0, SpriteStart, SpriteSize, Verified, OpaqueRect));
 			}
 
-			bool LoadSFFFile(const std::string& FileName_, const std::string& FilePath_) {
-				if (!empty()) { clear(); }
-				T_LoadSFFHeader LoadSFFHeader(FileName_, FilePath_);
-				if (LoadSFFHeader.CheckError()) { return false; }
-				T_LoadSFFSubHeader LoadSFFSubHeader(LoadSFFHeader);
-				if (LoadSFFSubHeader.CheckError()) { return false; }
+			void AddDecodedDedupSprite() noexcept {
+				++NumDecodedDedupSprite_;
+			}
 
-				ReserveSpriteData(LoadSFFHeader);
+			// ǂݍ݌t@C̉摜f[^̃oCgAi[̉摜f[^։Z(d̍팸ʂ̎ZoɎgp)
+			void AddFileSpriteSize(ksize_t SpriteListIndex, ksize_t Size) noexcept {
+				SpriteList_[SpriteListIndex].AddFileByteSize(Size);
+			}
 
-				for (int32_t LoadNo = 0; LoadNo < LoadSFFHeader.NumImages(); ++LoadNo) {
-					if (LoadSFFSubHeader.ReadSpriteBinary(LoadNo, SpriteNumberUMap, SpriteDataUMap, SFFBinaryData)) { break; };
-				}
-				NumGroup(LoadSFFHeader.NumGroups());
-				NumImage(static_cast<int32_t>(SpriteNumberUMap.size()));
-				FileName(LoadSFFHeader.FileName());
+			// ǂݍ݌t@C̃pbgf[^1ǂݍ(Stored = VKpbgƂĊi[)
+			void AddFilePalette(bool Stored) noexcept {
+				FilePaletteSize_ += SFFFormat::kSFFPaletteSize;
+				if (Stored) { ++NumFilePalette_; }
+			}
 
-				// SẴ[hI]Ɋmۂ
-				shrink_to_fit();
+			void AddPalette(const std::array<unsigned char, SFFFormat::kSFFPaletteSize>& LoadPaletteData) {
+				Palette_.insert(Palette_.end(), LoadPaletteData.begin(), LoadPaletteData.end());
+			}
 
-				// Oo
-				if (T_Config::Instance().CreateLogFile()) {
-					T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSffFileFormat::kSystemDirectoryName : ""));
-					if (SAELibFile.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::SAELibFolderInvalidPath);
-						return false;
-					}
-					if (T_Config::Instance().CreateSAELibFile()) {
-						SAELibFile.CreateDirectory(SAELibFile.Path());
-						if (SAELibFile.ErrorCode()) {
-							T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSAELibFolderFailed);
-							return false;
-						}
-					}
+		public:
+			T_SFFBinaryData() = default;
 
-					const std::string ErrorLogFileName = std::string(ReadSffFileFormat::kErrorLogFileName) + "_" + FileName() + ".txt";
-					std::ofstream ErrorLogFile(SAELibFile.Path() / ErrorLogFileName);
-					if (!ErrorLogFile.is_open()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::CreateErrorLogFileFailed);
-					}
-					T_ErrorHandle::Instance().WriteErrorLog(ErrorLogFile);
-				}
+			explicit T_SFFBinaryData(std::pmr::memory_resource* const Resource)
+				: SpriteList_(Resource), IndexList_(Resource), DataList_(Resource), Sprite_(Resource), Palette_(Resource) {
+			}
 
-				return true;
+			// ̓Rs[Ɠ\[Xgp
+			T_SFFBinaryData(const T_SFFBinaryData& Other)
+				: SpriteList_(Other.SpriteList_, Other.resource()), IndexList_(Other.IndexList_, Other.resource()), DataList_(Other.DataList_, Other.resource())
+				, Sprite_(Other.Sprite_), Palette_(Other.Palette_, Other.resource())
+				, CollisionMask_(Other.CollisionMask_), DecodedSprite_(Other.DecodedSprite_), NumDecodedDedupSprite_(Other.NumDecodedDedupSprite_)
+				, FilePaletteSize_(Other.FilePaletteSize_), NumFilePalette_(Other.NumFilePalette_) {
 			}
+			T_SFFBinaryData(T_SFFBinaryData&&) = default;
+			T_SFFBinaryData& operator=(const T_SFFBinaryData&) = default;
+			T_SFFBinaryData& operator=(T_SFFBinaryData&&) = default;
 
-			// oCif[^o(dȂ)
-			[[nodiscard]] bool WriteBMPFile(ksize_t index, const std::filesystem::path& FullPath) const {
-				// SFF̃oCiBMPtH[}bg֑gݗ
-				T_BuildBMPBinary BMPBinary(SFFBinaryData.IndexList_Sprite(index), SFFBinaryData.IndexList_Palette(index), SFFBinaryData.IndexList_SpriteSize(index));
-				std::ofstream File(FullPath, std::ios::binary);
-				if (!File.is_open()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateBMPFileFailed);
+			// 摜f[^̓`NPʂŊmۂ邽߁At@CTCY̎Omۂ͍sȂ
+			void reserve(ksize_t NumImage, ksize_t PaletteSize) {
+				SpriteList_.reserve(NumImage);
+				IndexList_.reserve(NumImage);
+				DataList_.reserve(NumImage);
+				Sprite_.reserve(NumImage);
+				Palette_.reserve(PaletteSize);
+			}
+
+			void clear() {
+				SpriteList_.clear();
+				IndexList_.clear();
+				DataList_.clear();
+				Sprite_.clear();
+				Palette_.clear();
+				CollisionMask_.clear();
+				DecodedSprite_.clear();
+				NumDecodedDedupSprite_ = 0;
+				FilePaletteSize_ = 0;
+				NumFilePalette_ = 0;
+			}
+
+			void shrink_to_fit() {
+				SpriteList_.shrink_to_fit();
+				IndexList_.shrink_to_fit();
+				DataList_.shrink_to_fit();
+				Sprite_.shrink_to_fit(); // ǋL̃`N̂ݕ邽߈ꎞIȃ̓`N1
+				Palette_.shrink_to_fit();
+			}
+
+			[[nodiscard]] bool empty() const noexcept {
+				return SpriteList_.empty() && IndexList_.empty() && DataList_.empty() && Sprite_.empty() && Palette_.empty();
+			}
+
+			[[nodiscard]] ksize_t size() const noexcept {
+				return static_cast<ksize_t>(Sprite_.size() + Palette_.size());
+			}
+
+			void MemoryReport(T_MemoryReport& Report) const {
+				Report.SpriteList(SpriteList_);
+				Report.IndexList(IndexList_);
+				Report.DataList(DataList_);
+				Report.Sprite(Sprite_.MemoryUsage());
+				Report.Palette(Palette_);
+				Report.CollisionMask(CollisionMask_.MemoryUsage());
+				Report.DecodedSprite(DecodedSprite_.MemoryUsage());
+
+				// ǂݍ݌t@C̃oCgƁAdĊi[oCgr(̉摜f[^͏O)
+				size_t RawSpriteSize = 0;
+				size_t StoredSpriteSize = 0;
+				for (const auto& Sprite : SpriteList_) {
+					if (!Sprite.Resident() || !Sprite.FileByteSize()) { continue; }
+					RawSpriteSize += Sprite.FileByteSize();
+					StoredSpriteSize += Sprite.SpriteSize();
 				}
+				const size_t StoredPaletteSize = static_cast<size_t>(SFFFormat::kSFFPaletteSize) * NumFilePalette_;
+				Report.RawSpriteSize(RawSpriteSize);
+				Report.RawPaletteSize(static_cast<size_t>(FilePaletteSize_));
+				Report.SpriteDedupSavedSize(RawSpriteSize - StoredSpriteSize);
+				Report.PaletteDedupSavedSize(FilePaletteSize_ > StoredPaletteSize ? static_cast<size_t>(FilePaletteSize_) - StoredPaletteSize : 0);
+				Report.NumDecodedDedupSprite(NumDecodedDedupSprite_);
+			}
+		};
 
-				File.write(reinterpret_cast<const char*>(BMPBinary.data()), BMPBinary.size());
-				File.flush();
+#ifdef SAELIB_SFF_SHARED_MEMORY
+		// LSFFf[^̔zu(|C^ASċL̐擪̈ʒuŎQƂ)
+		// wb_[  t@C  XvCgXg  CfbNXXg  f[^Xg  pbgf[^  摜f[^
+		struct T_SharedSFFLayout {
+		private:
+			inline static constexpr std::string_view kSignature = "SAESFFSM";
+			inline static constexpr uint32_t kVersion = 1;
+			inline static constexpr size_t kHeaderSize = 104;
+			inline static constexpr size_t kSpriteListSize = 24;
+			inline static constexpr size_t kIndexListSize = 8;
+			inline static constexpr size_t kDataListSize = 12;
+
+			const unsigned char* const kSegment;
+			const size_t kSegmentSize;
+			bool Valid_ = false;
+
+			[[nodiscard]] static constexpr size_t Align(size_t value) noexcept { return (value + 7) & ~static_cast<size_t>(7); }
+
+			[[nodiscard]] uint32_t Header32(size_t Offset) const noexcept { return DecodeBinary::UInt32LE(kSegment + Offset); }
+			[[nodiscard]] uint64_t Header64(size_t Offset) const noexcept { return DecodeBinary::UInt64LE(kSegment + Offset); }
+
+			[[nodiscard]] bool CheckLayout() const noexcept {
+				if (kSegmentSize < kHeaderSize || std::memcmp(kSegment, kSignature.data(), kSignature.size()) || Header32(8) != kVersion) { return false; }
+				if (TotalSize() > kSegmentSize || kHeaderSize + FileNameSize() > TotalSize()) { return false; }
+				auto InRange = [&](uint64_t Offset, uint64_t Size) { return Offset <= TotalSize() && Size <= TotalSize() - Offset; };
+				return InRange(SpriteListOffset(), static_cast<uint64_t>(NumSprite()) * kSpriteListSize)
+					&& InRange(IndexListOffset(), static_cast<uint64_t>(NumIndex()) * kIndexListSize)
+					&& InRange(DataListOffset(), static_cast<uint64_t>(NumData()) * kDataListSize)
+					&& InRange(PaletteOffset(), static_cast<uint64_t>(NumPalette()) * SFFFormat::kSFFPaletteSize)
+					&& InRange(SpriteOffset(), SpriteSize()) && SpriteSize() <= KSIZE_MAX;
+			}
 
-				if (File.fail() || File.bad()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteBMPFileFailed);
+		public:
+			[[nodiscard]] int32_t NumGroup() const noexcept { return static_cast<int32_t>(Header32(12)); }
+			[[nodiscard]] int32_t NumImage() const noexcept { return static_cast<int32_t>(Header32(16)); }
+			[[nodiscard]] unsigned char SharedPal() const noexcept { return static_cast<unsigned char>(Header32(20)); }
+			[[nodiscard]] ksize_t NumSprite() const noexcept { return Header32(24); }
+			[[nodiscard]] ksize_t NumIndex() const noexcept { return Header32(28); }
+			[[nodiscard]] ksize_t NumData() const noexcept { return Header32(32); }
+			[[nodiscard]] ksize_t NumPalette() const noexcept { return Header32(36); }
+			[[nodiscard]] ksize_t FileNameSize() const noexcept { return Header32(40); }
+			[[nodiscard]] uint64_t SpriteListOffset() const noexcept { return Header64(48); }
+			[[nodiscard]] uint64_t IndexListOffset() const noexcept { return Header64(56); }
+			[[nodiscard]] uint64_t DataListOffset() const noexcept { return Header64(64); }
+			[[nodiscard]] uint64_t PaletteOffset() const noexcept { return Header64(72); }
+			[[nodiscard]] uint64_t SpriteOffset() const noexcept { return Header64(80); }
+			[[nodiscard]] uint64_t SpriteSize() const noexcept { return Header64(88); }
+			[[nodiscard]] uint64_t TotalSize() const noexcept { return Header64(96); }
+			[[nodiscard]] std::string FileName() const { return std::string(reinterpret_cast<const char*>(kSegment + kHeaderSize), FileNameSize()); }
+			[[nodiscard]] bool Valid() const noexcept { return Valid_; }
+
+			// o͂ɕKvȃoCg
+			[[nodiscard]] static size_t Size(const T_SFFBinaryData& SFFBinaryData, const std::string& FileName) noexcept {
+				size_t Size = Align(kHeaderSize + FileName.size());
+				Size += Align(kSpriteListSize * SFFBinaryData.NumSprite());
+				Size += Align(kIndexListSize * SFFBinaryData.IndexList().size());
+				Size += Align(kDataListSize * SFFBinaryData.DataList().size());
+				Size += Align(SFFBinaryData.Palette().size());
+				for (ksize_t index = 0; index < SFFBinaryData.NumSprite(); ++index) { Size += SFFBinaryData.SpriteSize(index); }
+				return Size;
+			}
+
+			// L֏o(ʎq͑vZXݓr̃f[^֐ڑȂ悤Ōɏ)
+			static void Write(unsigned char* const Segment, const T_SFFBinaryData& SFFBinaryData, int32_t NumGroup, int32_t NumImage, unsigned char SharedPal, const std::string& FileName) noexcept {
+				const uint64_t SpriteListOffset = Align(kHeaderSize + FileName.size());
+				const uint64_t IndexListOffset = SpriteListOffset + Align(kSpriteListSize * SFFBinaryData.NumSprite());
+				const uint64_t DataListOffset = IndexListOffset + Align(kIndexListSize * SFFBinaryData.IndexList().size());
+				const uint64_t PaletteOffset = DataListOffset + Align(kDataListSize * SFFBinaryData.DataList().size());
+				const uint64_t SpriteOffset = PaletteOffset + Align(SFFBinaryData.Palette().size());
+
+				unsigned char* Ptr = Segment + SpriteListOffset;
+				uint64_t SpriteStart = 0;
+				for (ksize_t index = 0; index < SFFBinaryData.NumSprite(); ++index, Ptr += kSpriteListSize) {
+					const T_OpaqueRect& OpaqueRect = SFFBinaryData.SpriteOpaqueRect(index);
+					EncodeBinary::UInt64LE(Ptr, SpriteStart);
+					EncodeBinary::UInt32LE(Ptr + 8, SFFBinaryData.SpriteSize(index));
+					EncodeBinary::UInt16LE(Ptr + 12, OpaqueRect.X);
+					EncodeBinary::UInt16LE(Ptr + 14, OpaqueRect.Y);
+					EncodeBinary::UInt16LE(Ptr + 16, OpaqueRect.Width);
+					EncodeBinary::UInt16LE(Ptr + 18, OpaqueRect.Height);
+					Ptr[20] = (SFFBinaryData.SpriteVerified(index) ? 1 : 0);
+					std::memcpy(Segment + SpriteOffset + SpriteStart, SFFBinaryData.Sprite(index), SFFBinaryData.SpriteSize(index));
+					SpriteStart += SFFBinaryData.SpriteSize(index);
 				}
-				File.close();
-				if (File.fail() || File.bad()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::CloseBMPFileFailed);
+				Ptr = Segment + IndexListOffset;
+				for (const auto& IndexList : SFFBinaryData.IndexList()) {
+					EncodeBinary::UInt32LE(Ptr, IndexList.SpriteListIndex());
+					EncodeBinary::UInt32LE(Ptr + 4, IndexList.PaletteIndex());
+					Ptr += kIndexListSize;
+				}
+				Ptr = Segment + DataListOffset;
+				for (const auto& DataList : SFFBinaryData.DataList()) {
+					EncodeBinary::UInt32LE(Ptr, DataList.IndexListNumber());
+					EncodeBinary::UInt32LE(Ptr + 4, static_cast<uint32_t>(Convert::EncodeSpriteAxis(DataList.AxisX(), DataList.AxisY())));
+					EncodeBinary::UInt32LE(Ptr + 8, static_cast<uint32_t>(DataList.SpriteNumber()));
+					Ptr += kDataListSize;
+				}
+				if (!SFFBinaryData.Palette().empty()) {
+					std::memcpy(Segment + PaletteOffset, SFFBinaryData.Palette().data(), SFFBinaryData.Palette().size());
 				}
 
-				return File.good();
+				EncodeBinary::UInt32LE(Segment + 8, kVersion);
+				EncodeBinary::UInt32LE(Segment + 12, static_cast<uint32_t>(NumGroup));
+				EncodeBinary::UInt32LE(Segment + 16, static_cast<uint32_t>(NumImage));
+				EncodeBinary::UInt32LE(Segment + 20, SharedPal);
+				EncodeBinary::UInt32LE(Segment + 24, SFFBinaryData.NumSprite());
+				EncodeBinary::UInt32LE(Segment + 28, static_cast<uint32_t>(SFFBinaryData.IndexList().size()));
+				EncodeBinary::UInt32LE(Segment + 32, static_cast<uint32_t>(SFFBinaryData.DataList().size()));
+				EncodeBinary::UInt32LE(Segment + 36, SFFBinaryData.NumPalette());
+				EncodeBinary::UInt32LE(Segment + 40, static_cast<uint32_t>(FileName.size()));
+				EncodeBinary::UInt64LE(Segment + 48, SpriteListOffset);
+				EncodeBinary::UInt64LE(Segment + 56, IndexListOffset);
+				EncodeBinary::UInt64LE(Segment + 64, DataListOffset);
+				EncodeBinary::UInt64LE(Segment + 72, PaletteOffset);
+				EncodeBinary::UInt64LE(Segment + 80, SpriteOffset);
+				EncodeBinary::UInt64LE(Segment + 88, SpriteStart);
+				EncodeBinary::UInt64LE(Segment + 96, SpriteOffset + SpriteStart);
+				std::memcpy(Segment + kHeaderSize, FileName.data(), FileName.size());
+				std::atomic_thread_fence(std::memory_order_release);
+				std::memcpy(Segment, kSignature.data(), kSignature.size());
 			}
 
-			// XvCgXgo(dL)
-			[[nodiscard]] bool WriteBMPFile(ksize_t index, const std::filesystem::path& FullPath, bool DuplicationSprite) const {
-				// SFF̃oCiBMPtH[}bg֑gݗ
-				T_BuildBMPBinary BMPBinary(SFFBinaryData.DataList_Sprite(index), SFFBinaryData.DataList_Palette(index), SFFBinaryData.DataList_SpriteSize(index));
-				std::ofstream File(FullPath, std::ios::binary);
-				if (!File.is_open()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateBMPFileFailed);
+			// L̕\i[֓WJ(摜f[^͕SegmentOwnerێ鋤LQƂ)
+			[[nodiscard]] bool Attach(T_SFFBinaryData& SFFBinaryData, const std::shared_ptr<const void>& SegmentOwner) const {
+				if (!Valid_) { return false; }
+				SFFBinaryData.clear();
+				SFFBinaryData.reserve(NumData(), NumPalette() * SFFFormat::kSFFPaletteSize);
+
+				const unsigned char* Ptr = kSegment + SpriteListOffset();
+				for (ksize_t index = 0; index < NumSprite(); ++index, Ptr += kSpriteListSize) {
+					const uint64_t SpriteStart = DecodeBinary::UInt64LE(Ptr);
+					const ksize_t Size = DecodeBinary::UInt32LE(Ptr + 8);
+					if (SpriteStart > SpriteSize() || Size > SpriteSize() - SpriteStart) { return false; }
+					// Ľ،ʂ͐MpA摜f[^؂(؍ς݂̉摜͋E`FbNȗĕ邽)
+					const T_VerifySpriteBinary VerifySpriteBinary(kSegment + SpriteOffset() + SpriteStart, Size);
+					SFFBinaryData.AddSharedSprite(static_cast<ksize_t>(SpriteStart), Size, VerifySpriteBinary.Verified(), VerifySpriteBinary.OpaqueRect());
 				}
+				Ptr = kSegment + IndexListOffset();
+				for (ksize_t index = 0; index < NumIndex(); ++index, Ptr += kIndexListSize) {
+					if (DecodeBinary::UInt32LE(Ptr) >= NumSprite() || DecodeBinary::UInt32LE(Ptr + 4) >= NumPalette()) { return false; }
+					SFFBinaryData.AddIndexList(DecodeBinary::UInt32LE(Ptr), DecodeBinary::UInt32LE(Ptr + 4));
+				}
+				Ptr = kSegment + DataListOffset();
+				for (ksize_t index = 0; index < NumData(); ++index, Ptr += kDataListSize) {
+					if (DecodeBinary::UInt32LE(Ptr) >= NumIndex()) { return false; }
+					const int32_t SpriteAxis = static_cast<int32_t>(DecodeBinary::UInt32LE(Ptr + 4));
+					const int32_t SpriteNumber = static_cast<int32_t>(DecodeBinary::UInt32LE(Ptr + 8));
+					SFFBinaryData.AddDataList(DecodeBinary::UInt32LE(Ptr), Convert::DecodeSpriteAxisX(SpriteAxis), Convert::DecodeSpriteAxisY(SpriteAxis)
+						, Convert::DecodeSpriteGroupNo(SpriteNumber), Convert::DecodeSpriteImageNo(SpriteNumber));
+				}
+				std::array<unsigned char, SFFFormat::kSFFPaletteSize> PaletteData = {};
+				for (ksize_t index = 0; index < NumPalette(); ++index) {
+					std::memcpy(PaletteData.data(), kSegment + PaletteOffset() + static_cast<size_t>(index) * SFFFormat::kSFFPaletteSize, PaletteData.size());
+					SFFBinaryData.AddPalette(PaletteData);
+				}
+				SFFBinaryData.AttachSprite(std::shared_ptr<const unsigned char>(SegmentOwner, kSegment + SpriteOffset()), static_cast<ksize_t>(SpriteSize()));
+				return true;
+			}
 
-				File.write(reinterpret_cast<const char*>(BMPBinary.data()), BMPBinary.size());
-				File.flush();
+		public:
+			T_SharedSFFLayout(const unsigned char* const Segment, size_t SegmentSize)
+				: kSegment(Segment), kSegmentSize(SegmentSize) {
+				Valid_ = CheckLayout();
+				std::atomic_thread_fence(std::memory_order_acquire);
+			}
+		};
+#endif
 
-				if (File.fail() || File.bad()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteBMPFileFailed);
+		// 摜pbg̃oCif[^SFFv1`֑gݗ
+		// 摜ƃpbg̑gݍ킹̓N摜AỎ摜Ɠpbg͋LpbgƂďo͂
+		struct T_BuildSFFBinary {
+		private:
+			inline static constexpr ksize_t kHeaderSize = SFFFormat::kSubHeaderStart;
+			inline static constexpr ksize_t kSubHeaderSize = SFFFormat::kFileLength;
+			inline static constexpr ksize_t kMaxLinkIndex = UINT16_MAX;
+
+			const T_SFFBinaryData& kSFFBinaryData;
+			const int32_t kNumGroup;
+			const unsigned char kSharedPal;
+			std::vector<unsigned char> SFFBinary = {};
+			bool Built_ = false; // false = t@CTCYSFFv1̏(4GiB)𒴂邽ߍ\złȂ
+
+			[[nodiscard]] static ksize_t DataList_PaletteIndex(const T_SFFBinaryData& SFFBinaryData, ksize_t index) noexcept {
+				return SFFBinaryData.IndexList(SFFBinaryData.DataList(index).IndexListNumber()).PaletteIndex();
+			}
+
+			// T_LoadSFFSubHeader::ReadSpriteBinary̋Lpbg̉߂ɍ킹Ĕ
+			[[nodiscard]] static bool SharedPalette(const T_SFFBinaryData& SFFBinaryData, ksize_t index) noexcept {
+				if (!index) { return false; } // 擪摜͌ŗLpbgƂĈ
+				const auto& Data = SFFBinaryData.DataList(index);
+				if (Data.GroupNo() == 0 && Data.ImageNo() == 0) {
+					return DataList_PaletteIndex(SFFBinaryData, index) == DataList_PaletteIndex(SFFBinaryData, 0);
 				}
-				File.close();
-				if (File.fail() || File.bad()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::CloseBMPFileFailed);
+				return DataList_PaletteIndex(SFFBinaryData, index) == DataList_PaletteIndex(SFFBinaryData, index - 1);
+			}
+
+			static void SetHeader(unsigned char* const HeaderPtr, const T_SFFBinaryData& SFFBinaryData, int32_t NumGroup, unsigned char SharedPal) noexcept {
+				std::memcpy(HeaderPtr, SFFFormat::kSignature.data(), SFFFormat::kSignature.size());
+				EncodeBinary::UInt32BE(&HeaderPtr[12], SFFFormat::kSFFV1Version);
+				EncodeBinary::UInt32LE(&HeaderPtr[16], static_cast<uint32_t>(NumGroup));
+				EncodeBinary::UInt32LE(&HeaderPtr[20], static_cast<uint32_t>(SFFBinaryData.DataList().size()));
+				EncodeBinary::UInt32LE(&HeaderPtr[24], SFFFormat::kSubHeaderStart);
+				EncodeBinary::UInt32LE(&HeaderPtr[28], SFFFormat::kFileLength);
+				HeaderPtr[32] = SharedPal;
+			}
+
+			void BuildSFFBinary() {
+				SFFBinary.reserve(kHeaderSize + kSubHeaderSize * kSFFBinaryData.DataList().size() + kSFFBinaryData.size());
+				Built_ = Write(kSFFBinaryData, kNumGroup, kSharedPal, [this](const unsigned char* const Data, size_t Size) {
+					SFFBinary.insert(SFFBinary.end(), Data, Data + Size);
+				});
+				if (!Built_) { std::vector<unsigned char>().swap(SFFBinary); }
+			}
+
+		public:
+			T_BuildSFFBinary(const T_SFFBinaryData& SFFBinaryData, int32_t NumGroup, unsigned char SharedPal)
+				: kSFFBinaryData(SFFBinaryData), kNumGroup(NumGroup), kSharedPal(SharedPal)
+			{
+				BuildSFFBinary();
+			}
+
+			// t@C̐擪珇Func(const unsigned char* Data, size_t Size)֏o(t@CŜɍ\zȂ)
+			// ̃Tuwb_[̈ʒu͏o͍ς݂̃oCg狁߂邽߁Ao͐1x擪珑߂Ηǂ
+			// Tuwb_[̈ʒu32bitɎ܂ȂȂꍇ́Ả摜̎Oŏo͂𒆒ffalseԂ
+			template <class Function>
+			[[nodiscard]] static bool Write(const T_SFFBinaryData& SFFBinaryData, int32_t NumGroup, unsigned char SharedPal, Function&& Func) {
+				unsigned char Header[kHeaderSize] = {};
+				SetHeader(Header, SFFBinaryData, NumGroup, SharedPal);
+				Func(Header, kHeaderSize);
+				uint64_t Offset = kHeaderSize;
+
+				// CfbNXXgƂɍŏɏo͂f[^Xg̃CfbNX(N)
+				std::vector<int32_t> LinkIndex(SFFBinaryData.IndexList().size(), -1);
+
+				for (ksize_t index = 0; index < SFFBinaryData.DataList().size(); ++index) {
+					const auto& Data = SFFBinaryData.DataList(index);
+					uint32_t PCXDataSize = 0;
+					uint16_t SpriteIndex = 0;
+					bool Linked = false;
+					bool SharedPalSprite = false;
+					if (LinkIndex[Data.IndexListNumber()] >= 0) {
+						SpriteIndex = static_cast<uint16_t>(LinkIndex[Data.IndexListNumber()]);
+						Linked = true;
+					}
+					else {
+						if (index <= kMaxLinkIndex) { LinkIndex[Data.IndexListNumber()] = static_cast<int32_t>(index); }
+						SharedPalSprite = SharedPalette(SFFBinaryData, index);
+						const uint64_t DataSize = static_cast<uint64_t>(SFFBinaryData.DataList_SpriteSize(index)) + (SharedPalSprite ? 0 : SFFFormat::kSFFPaletteSize);
+						if (DataSize > UINT32_MAX) { return false; }
+						PCXDataSize = static_cast<uint32_t>(DataSize);
+					}
+					Offset += kSubHeaderSize + PCXDataSize;
+					if (Offset > UINT32_MAX) { return false; }
+
+					unsigned char SubHeader[kSubHeaderSize] = {};
+					EncodeBinary::UInt32LE(&SubHeader[0], static_cast<uint32_t>(Offset)); // ̃Tuwb_[(̉摜̓t@CI[)
+					EncodeBinary::UInt32LE(&SubHeader[4], PCXDataSize);
+					EncodeBinary::UInt16LE(&SubHeader[8], static_cast<uint16_t>(Data.AxisX()));
+					EncodeBinary::UInt16LE(&SubHeader[10], static_cast<uint16_t>(Data.AxisY()));
+					EncodeBinary::UInt16LE(&SubHeader[12], static_cast<uint16_t>(Data.GroupNo()));
+					EncodeBinary::UInt16LE(&SubHeader[14], static_cast<uint16_t>(Data.ImageNo()));
+					EncodeBinary::UInt16LE(&SubHeader[16], SpriteIndex);
+					SubHeader[18] = (SharedPalSprite ? 1 : 0);
+					Func(SubHeader, kSubHeaderSize);
+
+					if (!Linked) {
+						Func(SFFBinaryData.DataList_Sprite(index), static_cast<size_t>(SFFBinaryData.DataList_SpriteSize(index)));
+						if (!SharedPalSprite) {
+							Func(SFFBinaryData.DataList_Palette(index), static_cast<size_t>(SFFFormat::kSFFPaletteSize));
+						}
+					}
 				}
+				return true;
+			}
 
-				return File.good();
+			[[nodiscard]] bool Built() const noexcept {
+				return Built_;
 			}
 
-			// [U[T_DataListANZXi
-			struct T_AccessData {
-			private:
-				const T_SFFBinaryData* const kSFFBinaryDataPtr;
-				const ksize_t kDataListIndex; // zIndex(ől̂Ƃ_~[f[^tOƂĎgp)
+			[[nodiscard]] const unsigned char* const data() const noexcept {
+				return SFFBinary.data();
+			}
 
-				const auto& ParamRef() const noexcept { return kSFFBinaryDataPtr->DataList(kDataListIndex); }
+			[[nodiscard]] size_t size() const noexcept {
+				return SFFBinary.size();
+			}
+		};
 
-				inline static constexpr unsigned char kDummyBinaryArray[1] = { 0 };
-				inline static constexpr const unsigned char* kDummyBinaryData = kDummyBinaryArray;
+		// 8bit̃pbgԍ̉fSFFv1̉摜f[^(PCX)\z
+		// RLE̘A͍sׂA0xC0ȏ̒PƂ̒lA1Ƃďo͂邽߁AT_VerifySpriteBinary̌؂Kʂ
+		struct T_EncodePCX {
+		private:
+			inline static constexpr ksize_t kHeaderSize = SFFFormat::kSpriteBinaryPixelOffbits;
+			inline static constexpr int32_t kMaxFillCount = 0x3F;
+			inline static constexpr unsigned char kPaletteMarker = 0x0C; // 256Fpbg̊Jnl(SFFv1ł̓pbg{̂̓Tuwb_[ň)
 
-			public:
-				/**
-				* @brief _~[f[^f
-				*
-				* @g_~[f[^ł邩mF܂
-				* 
-				* @SFFConfig::SetThrowError̐ݒ肪OFF̏ꍇɃG[̂߂Ɏgp܂
-				*
-				* @return bool (false = gȃf[^Ftrue = g_~[f[^)
-				*/
-				bool IsDummy() const noexcept { return kDataListIndex == KSIZE_MAX; }
+		public:
+			inline static constexpr int32_t kMaxSize = UINT16_MAX - 1; // BytesPerLine(ɐ؂グ)16bitɎ܂őTCY
+			inline static constexpr uint16_t kDefaultDPI = 72;
 
-				/**
-				* @brief WX̎擾
-				*
-				* @SAEŐݒ肵WXԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t AxisX WX
+			[[nodiscard]] inline static constexpr uint16_t BytesPerLine(uint16_t Width) noexcept {
+				return static_cast<uint16_t>((Width + 1) & ~1);
+			}
+
+			// Pitch͓͉f1s̃oCgAWidthEHeight1 ` kMaxSize
+			[[nodiscard]] inline static std::vector<unsigned char> Encode(const unsigned char* const Pixel, uint16_t Width, uint16_t Height, size_t Pitch, uint16_t HDPI = kDefaultDPI, uint16_t VDPI = kDefaultDPI) {
+				const uint16_t kBytesPerLine = BytesPerLine(Width);
+				std::vector<unsigned char> SpriteBinary(kHeaderSize, 0x00);
+				SpriteBinary.reserve(kHeaderSize + static_cast<size_t>(kBytesPerLine) * Height + 1);
+
+				unsigned char* const HeaderPtr = SpriteBinary.data();
+				HeaderPtr[0] = 0x0A; // ʎq
+				HeaderPtr[1] = 0x05; // o[W
+				HeaderPtr[2] = 0x01; // RLEk
+				HeaderPtr[3] = 0x08; // rbg
+				EncodeBinary::UInt16LE(&HeaderPtr[8], static_cast<uint16_t>(Width - 1));
+				EncodeBinary::UInt16LE(&HeaderPtr[10], static_cast<uint16_t>(Height - 1));
+				EncodeBinary::UInt16LE(&HeaderPtr[12], HDPI);
+				EncodeBinary::UInt16LE(&HeaderPtr[14], VDPI);
+				HeaderPtr[65] = 0x01; // v[
+				EncodeBinary::UInt16LE(&HeaderPtr[66], kBytesPerLine);
+
+				for (int32_t y = 0; y < Height; ++y) {
+					const unsigned char* const LinePtr = Pixel + static_cast<size_t>(y) * Pitch;
+					// s̗](BytesPerLinẽpfBO)0Ŗ߂
+					auto Value = [&](int32_t x) { return (x < Width ? LinePtr[x] : static_cast<unsigned char>(0x00)); };
+					for (int32_t x = 0; x < kBytesPerLine;) {
+						const unsigned char FillValue = Value(x);
+						int32_t FillCount = 1;
+						while (FillCount < kMaxFillCount && x + FillCount < kBytesPerLine && Value(x + FillCount) == FillValue) { ++FillCount; }
+						if (FillCount > 1 || (FillValue & 0xC0) == 0xC0) {
+							SpriteBinary.push_back(static_cast<unsigned char>(0xC0 | FillCount));
+						}
+						SpriteBinary.push_back(FillValue);
+						x += FillCount;
+					}
+				}
+				SpriteBinary.push_back(kPaletteMarker);
+				return SpriteBinary;
+			}
+		};
+
+		// 摜̏kłiqɕׂꗗ摜(24bitBMP)̐
+		// e摜͕s̋`ZɎ܂悤kApbgʂFŕ`悷
+		struct T_BuildContactSheet {
+		private:
+			inline static constexpr ksize_t kBMPHeaderSize = 14 + 40;
+			inline static constexpr unsigned char kBackground = 0x40; // Z̔wiF()
+
+			const T_SFFBinaryData& kSFFBinaryData;
+			const std::vector<ksize_t>& kDataListIndex; // Z̕я̉摜
+			const int32_t kCellSize;
+			const int32_t kColumns;
+			const int32_t kRows;
+			const bool kBoxFilter;
+			std::vector<unsigned char> BMPBinary = {};
+
+			[[nodiscard]] int32_t Width() const noexcept { return kCellSize * kColumns; }
+			[[nodiscard]] int32_t Height() const noexcept { return kCellSize * kRows; }
+			[[nodiscard]] size_t Stride() const noexcept { return (static_cast<size_t>(Width()) * 3 + 3) & ~static_cast<size_t>(3); }
+
+			void SetBMPHeader() {
+				unsigned char* const Header = BMPBinary.data();
+				Header[0] = 'B';
+				Header[1] = 'M';
+				EncodeBinary::UInt32LE(&Header[2], static_cast<uint32_t>(BMPBinary.size()));
+				EncodeBinary::UInt32LE(&Header[10], static_cast<uint32_t>(kBMPHeaderSize));
+				EncodeBinary::UInt32LE(&Header[14], 40);
+				EncodeBinary::UInt32LE(&Header[18], static_cast<uint32_t>(Width()));
+				EncodeBinary::UInt32LE(&Header[22], static_cast<uint32_t>(Height()));
+				EncodeBinary::UInt16LE(&Header[26], 1);
+				EncodeBinary::UInt16LE(&Header[28], 24);
+				EncodeBinary::UInt32LE(&Header[34], static_cast<uint32_t>(BMPBinary.size() - kBMPHeaderSize));
+			}
+
+			// s̋`݂̂𕜌(؂̉摜ɂgp邽ߔ͈͂mFȂH)
+			// ̓XbhƂɎg
+			static void DecodeOpaqueRect(const unsigned char* const SpriteBinary, ksize_t SpriteBinarySize, const T_OpaqueRect& Rect, std::vector<unsigned char>& Pixel) {
+				Pixel.assign(static_cast<size_t>(Rect.Width) * Rect.Height, 0);
+				const int32_t BytesPerLine = DecodeBinary::UInt16LE(&SpriteBinary[66]);
+				ksize_t SpriteBinaryOffSet = SFFFormat::kSpriteBinaryPixelOffbits;
+				for (int32_t y = 0; y < Rect.Y + Rect.Height; ++y) {
+					int32_t DecodePtrOffSet = 0;
+					while (DecodePtrOffSet < BytesPerLine && SpriteBinaryOffSet < SpriteBinarySize) {
+						uint8_t Byte = SpriteBinary[SpriteBinaryOffSet++];
+						int32_t FillCount = 1;
+						if ((Byte & 0xC0) == 0xC0) {
+							if (SpriteBinaryOffSet >= SpriteBinarySize) { return; }
+							FillCount = (std::min)(Byte & 0x3F, BytesPerLine - DecodePtrOffSet);
+							Byte = SpriteBinary[SpriteBinaryOffSet++];
+						}
+						if (Byte && y >= Rect.Y) {
+							const int32_t Begin = (std::max)(DecodePtrOffSet, static_cast<int32_t>(Rect.X));
+							const int32_t End = (std::min)(DecodePtrOffSet + FillCount, Rect.X + Rect.Width);
+							if (Begin < End) { std::memset(&Pixel[static_cast<size_t>(y - Rect.Y) * Rect.Width + (Begin - Rect.X)], Byte, End - Begin); }
+						}
+						DecodePtrOffSet += FillCount;
+					}
+				}
+			}
+
+			void DrawCell(size_t Cell) {
+				thread_local std::vector<unsigned char> Pixel = {};
+
+				const ksize_t index = kDataListIndex[Cell];
+				const ksize_t IndexListNumber = kSFFBinaryData.DataList(index).IndexListNumber();
+				const T_OpaqueRect& Rect = kSFFBinaryData.IndexList_SpriteOpaqueRect(IndexListNumber);
+				if (Rect.Width == 0 || Rect.Height == 0 || !kSFFBinaryData.IndexList_SpriteResident(IndexListNumber)) { return; } // ς݂̉摜͔wî܂
+				DecodeOpaqueRect(kSFFBinaryData.IndexList_Sprite(IndexListNumber), kSFFBinaryData.IndexList_SpriteSize(IndexListNumber), Rect, Pixel);
+				const unsigned char* const Palette = kSFFBinaryData.IndexList_Palette(IndexListNumber);
+
+				// cۂ܂܃ZɎ߁Ag͂Ȃ
+				const int32_t SrcWidth = Rect.Width;
+				const int32_t SrcHeight = Rect.Height;
+				const int32_t LongSide = (std::max)(SrcWidth, SrcHeight);
+				const int32_t DstWidth = (LongSide <= kCellSize ? SrcWidth : (std::max)(1, SrcWidth * kCellSize / LongSide));
+				const int32_t DstHeight = (LongSide <= kCellSize ? SrcHeight : (std::max)(1, SrcHeight * kCellSize / LongSide));
+				const int32_t CellX = static_cast<int32_t>(Cell % kColumns) * kCellSize + (kCellSize - DstWidth) / 2;
+				const int32_t CellY = static_cast<int32_t>(Cell / kColumns) * kCellSize + (kCellSize - DstHeight) / 2;
+
+				for (int32_t dy = 0; dy < DstHeight; ++dy) {
+					const int32_t y0 = (kBoxFilter ? dy * SrcHeight / DstHeight : (2 * dy + 1) * SrcHeight / (2 * DstHeight));
+					const int32_t y1 = (kBoxFilter ? (std::max)(y0 + 1, (dy + 1) * SrcHeight / DstHeight) : y0 + 1);
+					unsigned char* BMPPtr = BMPBinary.data() + kBMPHeaderSize + static_cast<size_t>(Height() - 1 - (CellY + dy)) * Stride() + static_cast<size_t>(CellX) * 3;
+					for (int32_t dx = 0; dx < DstWidth; ++dx, BMPPtr += 3) {
+						const int32_t x0 = (kBoxFilter ? dx * SrcWidth / DstWidth : (2 * dx + 1) * SrcWidth / (2 * DstWidth));
+						const int32_t x1 = (kBoxFilter ? (std::max)(x0 + 1, (dx + 1) * SrcWidth / DstWidth) : x0 + 1);
+
+						// ȉf͔wiFƂĕ
+						uint32_t R = 0, G = 0, B = 0;
+						for (int32_t y = y0; y < y1; ++y) {
+							const unsigned char* PixelPtr = &Pixel[static_cast<size_t>(y) * SrcWidth];
+							for (int32_t x = x0; x < x1; ++x) {
+								const unsigned char Index = PixelPtr[x];
+								R += (Index ? Palette[Index * 3 + 0] : kBackground);
+								G += (Index ? Palette[Index * 3 + 1] : kBackground);
+								B += (Index ? Palette[Index * 3 + 2] : kBackground);
+							}
+						}
+						const uint32_t Count = static_cast<uint32_t>((y1 - y0) * (x1 - x0));
+						BMPPtr[0] = static_cast<unsigned char>(B / Count);
+						BMPPtr[1] = static_cast<unsigned char>(G / Count);
+						BMPPtr[2] = static_cast<unsigned char>(R / Count);
+					}
+				}
+			}
+
+		public:
+			// Parallel = falsȅꍇ͌ĂяõXbĥ݂ŏ(t@Cɏꍇp)
+			T_BuildContactSheet(const T_SFFBinaryData& SFFBinaryData, const std::vector<ksize_t>& DataListIndex, int32_t CellSize, int32_t Columns, bool BoxFilter, bool Parallel)
+				: kSFFBinaryData(SFFBinaryData), kDataListIndex(DataListIndex), kCellSize(CellSize)
+				, kColumns((std::max)(1, (std::min)(Columns, static_cast<int32_t>(DataListIndex.size()))))
+				, kRows(static_cast<int32_t>((DataListIndex.size() + kColumns - 1) / kColumns)), kBoxFilter(BoxFilter)
+			{
+				if (kCellSize <= 0 || DataListIndex.empty()) { return; }
+				BMPBinary.resize(kBMPHeaderSize + Stride() * Height(), kBackground);
+				std::memset(BMPBinary.data(), 0, kBMPHeaderSize);
+				SetBMPHeader();
+				if (Parallel) {
+					T_ParallelFor::Run(kDataListIndex.size(), [&](size_t Cell) { DrawCell(Cell); });
+				}
+				else {
+					for (size_t Cell = 0; Cell < kDataListIndex.size(); ++Cell) { DrawCell(Cell); }
+				}
+			}
+
+			[[nodiscard]] const std::vector<unsigned char>& vecdata() const noexcept {
+				return BMPBinary;
+			}
+
+			[[nodiscard]] const unsigned char* const data() const noexcept {
+				return BMPBinary.data();
+			}
+
+			[[nodiscard]] ksize_t size() const noexcept {
+				return static_cast<ksize_t>(BMPBinary.size());
+			}
+		};
+
+		// ǂݑt̃t@Cǂݍ(std::ifstreamƓgœǂݍ݁Eړs)
+		// Tuwb_[Ɖ摜f[^͑唼t@CŘAĂ邽߁A͈͓̔̓ǂݍ݂ƈړ̓t@CANZXsȂ
+		struct T_BufferedFileReader {
+		public:
+			static constexpr size_t kWindowSize = 1 << 20; // ǂݑ̍őTCY(1MiB)
+			static constexpr size_t kSparseWindowSize = SFFFormat::kFileLength; // ǂݑ̍ŏTCY(Tuwb_[1)
+
+		private:
+			size_t WindowSize_ = kWindowSize;
+			std::ifstream File = {};
+			std::vector<unsigned char> Window = {};
+			uint64_t FileSize_ = 0;
+			uint64_t WindowStart = 0;  // ǂݑ̐擪̃t@Cʒu
+			uint64_t FilePosition = 0; // std::ifstream̓ǂݍ݈ʒu(̖ƈvĂΈړɑǂݍ)
+			uint64_t Position = 0;     // Ăяo猩ǂݍ݈ʒu
+			bool Fail_ = false;
+
+			// wʒu瑋ǂݍݒ
+			// ǂݍޏꍇ͑LAǂݔ΂ꍇ͑߂(Iʓǂݍ݂ł͓ǂݍމ摜̊ɉǂݍݗʂɂȂ)
+			void Fill(uint64_t Start) {
+				Window.clear();
+				WindowStart = Start;
+				if (Start >= FileSize_) { return; }
+				if (Start != FilePosition) {
+					WindowSize_ = (std::max)(WindowSize_ / 2, kSparseWindowSize);
+					File.clear();
+					File.seekg(static_cast<std::streamoff>(Start));
+				}
+				else {
+					WindowSize_ = (std::min)(WindowSize_ * 2, kWindowSize);
+				}
+				Window.resize(static_cast<size_t>((std::min<uint64_t>)(WindowSize_, FileSize_ - Start)));
+				File.read(reinterpret_cast<char*>(Window.data()), static_cast<std::streamsize>(Window.size()));
+				Window.resize(static_cast<size_t>(File.gcount()));
+				FilePosition = Start + Window.size();
+			}
+
+			// oRɓǂݍ(傫ǂݍݗp)
+			[[nodiscard]] size_t ReadDirect(unsigned char* Dest, uint64_t Start, size_t Count) {
+				if (Start >= FileSize_) { return 0; }
+				if (Start != FilePosition) {
+					File.clear();
+					File.seekg(static_cast<std::streamoff>(Start));
+				}
+				File.read(reinterpret_cast<char*>(Dest), static_cast<std::streamsize>(Count));
+				const size_t ReadSize = static_cast<size_t>(File.gcount());
+				FilePosition = Start + ReadSize;
+				return ReadSize;
+			}
+
+		public:
+			[[nodiscard]] bool is_open() const { return File.is_open(); }
+			[[nodiscard]] bool good() const noexcept { return !Fail_; }
+			explicit operator bool() const noexcept { return !Fail_; }
+			[[nodiscard]] bool operator!() const noexcept { return Fail_; }
+			void clear() noexcept { Fail_ = false; }
+
+			// ǂݑ̏TCY(ǂݍݑOɐݒ肵ꍇ̂ݗLAȍ~͓ǂݍ݈ʒuɉkSparseWindowSize`kWindowSize̊ԂŒ)
+			void WindowSize(size_t Size) noexcept { WindowSize_ = (std::clamp)(Size, kSparseWindowSize, kWindowSize); }
+
+			void open(const std::filesystem::path& FilePath, std::ios_base::openmode Mode = std::ios::binary) {
+				File.rdbuf()->pubsetbuf(nullptr, 0); // ǂݍ݂͑Pʂōsstd::ifstream̃obt@͎gpȂ
+				File.open(FilePath, Mode | std::ios::binary);
+				std::error_code ErrorCode = {};
+				FileSize_ = (File.is_open() ? std::filesystem::file_size(FilePath, ErrorCode) : 0);
+				if (ErrorCode) { FileSize_ = 0; }
+			}
+
+			// ǂݍ݂Ɏsꍇ͓ǂݍ߂̂݊i[ĎsԂɂ
+			void read(char* _Str, std::streamsize _Count) {
+				if (Fail_) { return; }
+				unsigned char* Dest = reinterpret_cast<unsigned char*>(_Str);
+				size_t Remain = static_cast<size_t>(_Count);
+				while (Remain) {
+					if (Position < WindowStart || Position >= WindowStart + Window.size()) {
+						if (Remain >= WindowSize_) {
+							const size_t ReadSize = ReadDirect(Dest, Position, Remain);
+							Position += ReadSize;
+							if (ReadSize < Remain) { Fail_ = true; }
+							return;
+						}
+						Fill(Position);
+						if (Window.empty()) {
+							Fail_ = true;
+							return;
+						}
+					}
+					const size_t Offset = static_cast<size_t>(Position - WindowStart);
+					const size_t CopySize = (std::min)(Remain, Window.size() - Offset);
+					std::memcpy(Dest, Window.data() + Offset, CopySize);
+					Dest += CopySize;
+					Position += CopySize;
+					Remain -= CopySize;
+				}
+			}
+
+			// ړ͓ǂݍ݈ʒu̕ύX̂(sԂ̏ꍇ͈ړȂ)
+			void seekg(std::streamoff _Off, std::ios_base::seekdir _Way = std::ios::beg) {
+				if (Fail_) { return; }
+				const int64_t Base = (_Way == std::ios::cur ? static_cast<int64_t>(Position) : _Way == std::ios::end ? static_cast<int64_t>(FileSize_) : 0);
+				if (Base + _Off < 0) {
+					Fail_ = true;
+					return;
+				}
+				Position = static_cast<uint64_t>(Base + _Off);
+			}
+
+			[[nodiscard]] std::streampos tellg() const noexcept {
+				return (Fail_ ? std::streampos(-1) : std::streampos(static_cast<std::streamoff>(Position)));
+			}
+
+			T_BufferedFileReader() = default;
+		};
+
+		// SFFǂݍݎ̃wb_[i[
+		struct T_LoadSFFHeader {
+		private:
+			const std::string kFileName = {};
+			const std::string kFilePath = {};
+			const uintmax_t kFileSize = 0;
+			const size_t kWindowSize = T_BufferedFileReader::kWindowSize;
+			T_BufferedFileReader File = {};
+			unsigned char buffer[33] = {};
+			const bool kCheckError = false;
+			// 0`11 ʎq("ElecbyteSpr")
+			// 12` C
+			// 33` ]
+			// 36` Rg
+
+			[[nodiscard]] const std::string EnsureSffExtension(const std::filesystem::path& FileName) const {
+				std::filesystem::path FixedFileName = FileName;
+				if (FixedFileName.extension() != SFFFormat::kExtension) {
+					if (!FixedFileName.extension().empty()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidSFFExtension);
+					}
+					FixedFileName.replace_extension(SFFFormat::kExtension);
+				}
+				return FixedFileName.string();
+			}
+
+			[[nodiscard]] const std::string FindFilePathDown(const std::string& FilePath) const {
+				T_FilePathSystem SFFFolder;
+				if (!FilePath.empty()) {
+					SFFFolder.SetPath(FilePath);
+					if (SFFFolder.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::LoadSFFInvalidPath);
+					}
+				}
+				if (FilePath.empty() || SFFFolder.ErrorCode() && !T_Config::Instance().SFFSearchPath().empty()) {
+					SFFFolder.SetPath(T_Config::Instance().SFFSearchPath());
+					if (SFFFolder.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::SFFSearchInvalidPath);
+					}
+				}
+				const std::filesystem::path AbsolutePath = (std::filesystem::exists(SFFFolder.Path()) ? SFFFolder.Path() : std::filesystem::canonical(std::filesystem::current_path()));
+
+				// T̒ɂΎqKw͒TȂ
+				if (std::filesystem::is_regular_file(AbsolutePath / kFileName)) {
+					return (AbsolutePath / kFileName).string();
+				}
+
+				for (const auto& entry : std::filesystem::recursive_directory_iterator(
+					AbsolutePath, std::filesystem::directory_options::skip_permission_denied)) {
+					if (!entry.is_regular_file()) { continue; }
+					if (entry.path().filename() == kFileName) {
+						return entry.path().string();
+					}
+				}
+
+				T_ErrorHandle::Instance().SetError(ErrorMessage::SFFFileNotFound);
+				return {};
+			}
+
+			[[nodiscard]] bool CheckFileSize() const {
+				if (kFileSize <= UINT32_MAX) { return false; }
+				T_ErrorHandle::Instance().SetError(ErrorMessage::SFFFileSizeOver);
+				return true;
+			}
+			[[nodiscard]] bool CheckFilePath() const {
+				if (!FilePath().empty()) { return false; }
+				T_ErrorHandle::Instance().SetError(ErrorMessage::EmptySFFFilePath);
+				return true;
+			}
+			[[nodiscard]] bool CheckFileOpen() {
+				File.WindowSize(kWindowSize);
+				File.open(FilePath(), std::ios::binary);
+				if (File.is_open()) { return false; }
+				T_ErrorHandle::Instance().SetError(ErrorMessage::OpenSFFFileFailed);
+				return true;
+			}
+
+			[[nodiscard]] bool CheckSFFFormat() {
+				// t@Cǂݎ肪ނ̂ňꂩɂ܂Ƃ߂
+				File.read(reinterpret_cast<char*>(&buffer), sizeof(buffer));
+
+				if (Signature() != SFFFormat::kSignature) { 
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidSFFSignature);
+					return true;
+				}
+				if (Version() == SFFFormat::kSFFV2Version) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::UnsupportedSFFv2Version);
+					return true;
+				}
+				if (Version() == SFFFormat::kSFFV2_1Version) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::UnsupportedSFFv2_1Version);
+					return true;
+				}
+				if (Version() != SFFFormat::kSFFV1Version || 
+					SubHeaderStart() != SFFFormat::kSubHeaderStart ||
+					FileLength() != SFFFormat::kFileLength) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::BrokenSFFFile);
+					return true;
+				}
+
+				return false;
+			}
+
+			[[nodiscard]] bool CheckFileError() { // CheckFileOpen  CheckSFFFormat ̏Ŏs
+				return CheckFileSize() || CheckFilePath() || CheckFileOpen() || CheckSFFFormat();
+			}
+
+		public:
+			[[nodiscard]] const std::string& FileName() const noexcept { return kFileName; }
+			[[nodiscard]] const std::string& FilePath() const noexcept { return kFilePath; }
+			[[nodiscard]] ksize_t FileSize() const noexcept { return static_cast<ksize_t>(kFileSize); }
+			[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(buffer), SFFFormat::kSignature.size()); }
+			[[nodiscard]] uint32_t Version() const noexcept { return DecodeBinary::UInt32BE(&buffer[12]); }
+			[[nodiscard]] uint32_t NumGroups() const noexcept { return DecodeBinary::UInt32LE(&buffer[16]); }
+			[[nodiscard]] uint32_t NumImages() const noexcept { return DecodeBinary::UInt32LE(&buffer[20]); }
+			[[nodiscard]] uint32_t SubHeaderStart() const noexcept { return DecodeBinary::UInt32LE(&buffer[24]); }
+			[[nodiscard]] uint32_t FileLength() const noexcept { return DecodeBinary::UInt32LE(&buffer[28]); }
+			[[nodiscard]] unsigned char SharedPal() const noexcept { return buffer[32]; }
+			[[nodiscard]] bool CheckError() const noexcept { return kCheckError; }
+
+		public:
+			T_LoadSFFHeader(const std::string& FileName, const std::string& FilePath, size_t WindowSize = T_BufferedFileReader::kWindowSize)
+				: kFileName(EnsureSffExtension(FileName)), kFilePath(FindFilePathDown(FilePath))
+				, kFileSize(kFilePath.empty() ? 0 : std::filesystem::file_size(kFilePath)), kWindowSize(WindowSize), kCheckError(CheckFileError()) {
+			}
+
+			void seekg(std::streampos& _Pos, std::ios_base::seekdir _Way = std::ios::beg) {
+				File.seekg(static_cast<std::streamoff>(_Pos), _Way);
+			}
+			void seekg(uint32_t _Pos, std::ios_base::seekdir _Way = std::ios::beg) {
+				File.seekg(static_cast<std::streamoff>(_Pos), _Way);
+			}
+
+			void read(char* _Str, std::streamsize _Count) {
+				File.read(_Str, _Count);
+			}
+
+			[[nodiscard]] std::streampos tellg() {
+				return File.tellg();
+			}
+		};
+
+		// ēǂݍݎ̔rf[^(ύX̂Ȃ摜͌؂Əd`FbNȗĈp)
+		// t@C̈ʒuETCYEeSē摜f[^ύXȂƂ݂Ȃ
+		struct T_ReloadBaseData {
+		private:
+			const T_SFFBinaryData& kSFFBinaryData;
+			std::unordered_map<uint32_t, ksize_t> SpriteOffsetUMap = {}; // t@C̉摜f[^̈ʒu  r̃XvCgXg
+			std::vector<int32_t> SpriteListRemap = {}; // r̃XvCgXg  ēǂݍݐ̃XvCgXg(-1 = i[)
+			std::vector<ksize_t> LoadedSpriteList_ = {}; // t@CǂݍݒĊi[ēǂݍݐ̃XvCgXg
+
+		public:
+			explicit T_ReloadBaseData(const T_SFFBinaryData& SFFBinaryData)
+				: kSFFBinaryData(SFFBinaryData), SpriteListRemap(SFFBinaryData.NumSprite(), -1) {
+				for (ksize_t index = 0; index < SFFBinaryData.NumSprite(); ++index) {
+					if (SFFBinaryData.SpriteResident(index) && SFFBinaryData.SpriteList(index).FileOffset()) { SpriteOffsetUMap.emplace(SFFBinaryData.SpriteList(index).FileOffset(), index); }
+				}
+			}
+
+			[[nodiscard]] const T_SFFBinaryData& SFFBinaryData() const noexcept { return kSFFBinaryData; }
+
+			// ʒuɓẻ摜f[^Δr̃XvCgXg̃CfbNXԂ
+			[[nodiscard]] int32_t FindSprite(uint32_t DataOffset, const unsigned char* const Data, size_t DataSize) const {
+				const auto it = SpriteOffsetUMap.find(DataOffset);
+				if (it == SpriteOffsetUMap.end() || kSFFBinaryData.SpriteSize(it->second) != DataSize || std::memcmp(kSFFBinaryData.Sprite(it->second), Data, DataSize)) { return -1; }
+				return static_cast<int32_t>(it->second);
+			}
+
+			[[nodiscard]] int32_t Remap(ksize_t SpriteListIndex) const noexcept { return SpriteListRemap[SpriteListIndex]; }
+			void Remap(ksize_t SpriteListIndex, ksize_t NewSpriteListIndex) noexcept { SpriteListRemap[SpriteListIndex] = static_cast<int32_t>(NewSpriteListIndex); }
+
+			// r̉摜f[^͔rŏd`FbNς݂̂߁Ap摜͓ǂݍݒ摜Ƃ̂ݔr
+			[[nodiscard]] const std::vector<ksize_t>& LoadedSpriteList() const noexcept { return LoadedSpriteList_; }
+			void AddLoadedSprite(ksize_t SpriteListIndex) { LoadedSpriteList_.emplace_back(SpriteListIndex); }
+		};
+
+		// ǂݍމ摜̑Iʏ
+		struct T_LoadFilter {
+		public:
+			using Predicate = std::function<bool(int32_t, int32_t)>;
+
+		private:
+			Predicate Predicate_ = {};
+
+		public:
+			/**
+			* @brief wO[v̉摜݂̂ǂݍޏ쐬
+			*
+			* @param const std::vector<int32_t>& GroupList ǂݍރO[vԍ̈ꗗ
+			* @return LoadFilter ǂݍݏ
+			*/
+			[[nodiscard]] static T_LoadFilter Group(std::vector<int32_t> GroupList) {
+				std::sort(GroupList.begin(), GroupList.end());
+				return T_LoadFilter([GroupList = std::move(GroupList)](int32_t GroupNo, int32_t) { return std::binary_search(GroupList.begin(), GroupList.end(), GroupNo); });
+			}
+
+			/**
+			* @brief w͈͂̃O[v̉摜݂̂ǂݍޏ쐬
+			*
+			* @param int32_t MinGroupNo ǂݍރO[vԍ̍ŏl
+			* @param int32_t MaxGroupNo ǂݍރO[vԍ̍ől (̒l܂)
+			* @return LoadFilter ǂݍݏ
+			*/
+			[[nodiscard]] static T_LoadFilter GroupRange(int32_t MinGroupNo, int32_t MaxGroupNo) {
+				return T_LoadFilter([MinGroupNo, MaxGroupNo](int32_t GroupNo, int32_t) { return MinGroupNo <= GroupNo && GroupNo <= MaxGroupNo; });
+			}
+
+			/**
+			* @brief wԍ̉摜ǂݍނ𔻒
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @param int32_t ImageNo C[Wԍ
+			* @return bool 茋 (false = ǂݍ܂ȂFtrue = ǂݍ)
+			*/
+			bool Accept(int32_t GroupNo, int32_t ImageNo) const { return !Predicate_ || Predicate_(GroupNo, ImageNo); }
+
+			/**
+			* @brief ̗L擾
+			*
+			* @return bool (false = Ftrue = SẲ摜ǂݍ)
+			*/
+			bool empty() const noexcept { return !Predicate_; }
+
+		public:
+			T_LoadFilter() = default;
+
+			// O[vԍƃC[Wԍ󂯎Aǂݍޏꍇ true Ԃ֐w
+			T_LoadFilter(Predicate Function) : Predicate_(std::move(Function)) {}
+		};
+
+		// SFFǂݍݎ̃Tuwb_[i[
+		struct T_LoadSFFSubHeader {
+		private:
+			unsigned char buffer[19] = {}; // v̏̂݊i[
+			// 0`18 C
+			// 19` t@CƂĂꍇ(])
+			// 32` 摜f[^ + pbgf[^(0 or 768 Byte)
+			int32_t DuplicationCount_ = 0;
+			T_LoadSFFHeader& File;
+			T_ReloadBaseData* const kReloadBaseData;
+			const T_LoadFilter* const kLoadFilter; // nullptr = SẲ摜ǂݍ
+			const bool kDecodedSpriteDedup = T_Config::Instance().DecodedSpriteDedup(); // ǂݍݒ̐ݒύX̉e󂯂Ȃ悤JnɎ擾
+			std::vector<unsigned char> LoadSpriteData = {};
+			std::array<unsigned char, SFFFormat::kSFFPaletteSize> LoadPaletteData = {};
+			std::unordered_multimap<uint64_t, ksize_t> DecodedSpriteUMap = {}; // ̉f̃nbVlƃXvCgXg̃CfbNX
+
+			// Iʓǂݍݎ̃Tuwb_[1̎QƐ(d摜ԍt@C̏)
+			// ǂݍ܂Ȃ摜N摜ƋLpbg̎QƐƂĈʒû݋L^AKvɂȂ_œǂݍ
+			struct T_EntrySource {
+				uint32_t DataOffset = 0;	// 摜f[^̈ʒu
+				uint32_t DataSize = 0;		// 摜f[^̃TCY(ŗLpbg̏ꍇ̓pbgf[^܂)
+				uint32_t PaletteOffset = 0;	// Kppbgf[^̈ʒu
+				bool OwnPalette = false;	// ŗLpbg
+				int32_t Root = -1;			// NH̉摜f[^QƐ̃CfbNX
+				int32_t IndexListNumber = -1; // i[ς݂̏ꍇ̃CfbNXXg̔ԍ(-1 = i[)
+			};
+			std::vector<T_EntrySource> EntryList = {};
+			std::unordered_map<uint32_t, ksize_t> PaletteOffsetUMap = {}; // pbgf[^̈ʒuƃpbgXg̃CfbNX
+			T_UnorderedMap SkippedSpriteNumberUMap = {}; // ǂݍ܂Ȃ摜ԍ(摜ԍ̏dɎgp)
+
+			// ؍ς݂̉摜𕜌̉fɂd̑Ώۂ֓o^
+			void RegisterDecodedSprite(const T_DecodedSpritePixel& DecodedSprite, ksize_t SpriteListIndex) {
+				DecodedSpriteUMap.emplace(DecodedSprite.Hash(), SpriteListIndex);
+			}
+
+			// ̉fv摜̃XvCgXg̃CfbNXԂ(݂Ȃ-1)
+			[[nodiscard]] int32_t FindDecodedSprite(const T_DecodedSpritePixel& DecodedSprite, const T_SFFBinaryData& SFFBinaryData) const {
+				const auto Range = DecodedSpriteUMap.equal_range(DecodedSprite.Hash());
+				for (auto it = Range.first; it != Range.second; ++it) {
+					if (T_DecodedSpritePixel(SFFBinaryData.Sprite(it->second)) == DecodedSprite) { return static_cast<int32_t>(it->second); }
+				}
+				return -1;
+			}
+
+			// 摜f[^i[ApbgƂ̑gݍ킹̃CfbNXXg̔ԍԂ
+			// BaseSpriteListIndex0ȏ̏ꍇLoadSpriteDatȃɔr̉摜f[^p(-1 = LoadSpriteDatai[)
+			[[nodiscard]] ksize_t AddSpriteData(ksize_t PaletteListIndex, bool FoundPaletteData, uint32_t DataOffset, int32_t BaseSpriteListIndex, T_ReloadBaseData* const ReloadBaseData, T_UnorderedMap& SpriteDataUMap, T_SFFBinaryData& SFFBinaryData) {
+				const bool Inherited = (ReloadBaseData && BaseSpriteListIndex >= 0);
+				const unsigned char* const SpriteBinary = (Inherited ? ReloadBaseData->SFFBinaryData().Sprite(BaseSpriteListIndex) : LoadSpriteData.data());
+				const ksize_t SpriteSize = (Inherited ? ReloadBaseData->SFFBinaryData().SpriteSize(BaseSpriteListIndex) : static_cast<ksize_t>(LoadSpriteData.size()));
+				ksize_t SpriteListIndex = 0;
+				bool FoundSpriteData = false;
+
+				// r̓摜f[^i[ς݂Ȃ炻̃CfbNXw
+				if (Inherited && ReloadBaseData->Remap(BaseSpriteListIndex) >= 0) {
+					SpriteListIndex = ReloadBaseData->Remap(BaseSpriteListIndex);
+					FoundSpriteData = true;
+				}
+				else if (Inherited) {
+					// 摜f[^d`FbN(ǂݍݒ摜Ƃ̂ݔr)
+					SpriteListIndex = SFFBinaryData.NumSprite();
+					for (const ksize_t LoadedSpriteListIndex : ReloadBaseData->LoadedSpriteList()) {
+						if (SFFBinaryData.SpriteSize(LoadedSpriteListIndex) == SpriteSize && !std::memcmp(SFFBinaryData.Sprite(LoadedSpriteListIndex), SpriteBinary, SpriteSize)) {
+							SpriteListIndex = LoadedSpriteListIndex;
+							FoundSpriteData = true;
+							break;
+						}
+					}
+				}
+				else {
+					// 摜f[^d`FbN
+					for (SpriteListIndex = 0; SpriteListIndex < SFFBinaryData.NumSprite(); ++SpriteListIndex) {
+						// ̉摜f[^̏ꍇ̓CfbNXw
+						if (SFFBinaryData.SpriteSize(SpriteListIndex) == SpriteSize && !std::memcmp(SFFBinaryData.Sprite(SpriteListIndex), SpriteBinary, SpriteSize)) {
+							FoundSpriteData = true;
+							break;
+						}
+
+					}
+				}
+				// VK摜̏ꍇ͉摜f[^i[(rp摜͌،ʂp)
+				if (!FoundSpriteData) {
+					bool Verified = false;
+					T_OpaqueRect OpaqueRect = {};
+					if (Inherited) {
+						Verified = ReloadBaseData->SFFBinaryData().SpriteVerified(BaseSpriteListIndex);
+						OpaqueRect = ReloadBaseData->SFFBinaryData().SpriteOpaqueRect(BaseSpriteListIndex);
+					}
+					else {
+						const T_VerifySpriteBinary VerifySpriteBinary(SpriteBinary, SpriteSize);
+						Verified = VerifySpriteBinary.Verified();
+						OpaqueRect = VerifySpriteBinary.OpaqueRect();
+					}
+
+					// oCg񂪈قȂẲfvΊ̉摜f[^gp
+					if (kDecodedSpriteDedup && Verified) {
+						const T_DecodedSpritePixel DecodedSprite(SpriteBinary);
+						if (const int32_t DecodedSpriteListIndex = FindDecodedSprite(DecodedSprite, SFFBinaryData); DecodedSpriteListIndex >= 0) {
+							SpriteListIndex = DecodedSpriteListIndex;
+							FoundSpriteData = true;
+							SFFBinaryData.AddDecodedDedupSprite();
+						}
+						else {
+							SFFBinaryData.AddSprite(SpriteBinary, SpriteSize, true, OpaqueRect, DataOffset);
+							RegisterDecodedSprite(DecodedSprite, SpriteListIndex);
+						}
+					}
+					else {
+						SFFBinaryData.AddSprite(SpriteBinary, SpriteSize, Verified, OpaqueRect, DataOffset);
+					}
+					if (ReloadBaseData && !Inherited && !FoundSpriteData) { ReloadBaseData->AddLoadedSprite(SpriteListIndex); }
+				}
+				if (Inherited) { ReloadBaseData->Remap(BaseSpriteListIndex, SpriteListIndex); }
+				SFFBinaryData.AddFileSpriteSize(SpriteListIndex, SpriteSize);
+
+				// 摜ƃpbg̑gݍ킹VK̏ꍇCfbNXXg֓o^
+				if (!FoundPaletteData || !FoundSpriteData || !SpriteDataUMap.exist(SpriteListIndex, PaletteListIndex)) {
+					SFFBinaryData.AddIndexList(SpriteListIndex, PaletteListIndex);
+					SpriteDataUMap.Register(SpriteListIndex, PaletteListIndex);
+					return static_cast<ksize_t>(SFFBinaryData.IndexList().size()) - 1;
+				}
+				return SpriteDataUMap.find(SpriteListIndex, PaletteListIndex);
+			}
+
+			void AddDuplicationCount() {
+				++DuplicationCount_;
+			}
+
+			// ݈ʒủ摜f[^LoadSpriteData֓ǂݍ݁ArƓ摜f[^łΔr̃XvCgXg̃CfbNXԂ(-1 = rȂ)
+			[[nodiscard]] int32_t ReadSpriteData(size_t SpriteSize, T_ReloadBaseData* const ReloadBaseData) {
+				const uint32_t DataOffset = static_cast<uint32_t>(File.tellg());
+				LoadSpriteData.resize(SpriteSize);
+				File.read(reinterpret_cast<char*>(LoadSpriteData.data()), LoadSpriteData.size());
+				return (ReloadBaseData ? ReloadBaseData->FindSprite(DataOffset, LoadSpriteData.data(), LoadSpriteData.size()) : -1);
+			}
+
+			// wʒũpbgf[^̃pbgXg̃CfbNXԂ(i[ȂǂݍŊi[)
+			[[nodiscard]] ksize_t ResolvePalette(uint32_t PaletteOffset, T_SFFBinaryData& SFFBinaryData) {
+				if (const auto it = PaletteOffsetUMap.find(PaletteOffset); it != PaletteOffsetUMap.end()) { return it->second; }
+				File.seekg(PaletteOffset);
+				File.read(reinterpret_cast<char*>(LoadPaletteData.data()), SFFFormat::kSFFPaletteSize);
+				ksize_t PaletteListIndex = SFFBinaryData.FindPalette(LoadPaletteData.data());
+				const bool Stored = (PaletteListIndex >= SFFBinaryData.NumPalette());
+				if (Stored) {
+					PaletteListIndex = SFFBinaryData.NumPalette();
+					SFFBinaryData.AddPalette(LoadPaletteData);
+				}
+				SFFBinaryData.AddFilePalette(Stored);
+				PaletteOffsetUMap.emplace(PaletteOffset, PaletteListIndex);
+				return PaletteListIndex;
+			}
+
+			// QƐ̉摜f[^i[ăCfbNXXg̔ԍԂ(-1 = 摜f[^Ȃ)
+			[[nodiscard]] int32_t ResolveEntry(T_EntrySource& Entry, T_ReloadBaseData* const ReloadBaseData, T_UnorderedMap& SpriteDataUMap, T_SFFBinaryData& SFFBinaryData) {
+				if (Entry.IndexListNumber >= 0) { return Entry.IndexListNumber; }
+				if (!Entry.DataSize || (Entry.OwnPalette && Entry.DataSize < SFFFormat::kSFFPaletteSize)) { return -1; }
+				File.seekg(Entry.DataOffset);
+				const int32_t BaseSpriteListIndex = ReadSpriteData(static_cast<size_t>(Entry.DataSize) - (Entry.OwnPalette ? SFFFormat::kSFFPaletteSize : 0), ReloadBaseData);
+				const ksize_t PaletteListIndex = ResolvePalette(Entry.PaletteOffset, SFFBinaryData);
+				Entry.IndexListNumber = static_cast<int32_t>(AddSpriteData(PaletteListIndex, true, Entry.DataOffset, BaseSpriteListIndex, ReloadBaseData, SpriteDataUMap, SFFBinaryData));
+				return Entry.IndexListNumber;
+			}
+
+			// Iʓǂݍݎ̃Tuwb_[1̏
+			// ǂݍ܂Ȃ摜̓Tuwb_[̂ݎQƂA摜f[^͓ǂݔ΂
+			void ReadFilteredSpriteBinary(int32_t LoadNo, T_UnorderedMap& SpriteNumberUMap, T_UnorderedMap& SpriteDataUMap, T_SFFBinaryData& SFFBinaryData) {
+				const bool Accepted = kLoadFilter->Accept(GroupNo(), ImageNo());
+
+				// 擾摜ԍd(ǂݍ܂Ȃ摜͏d̒ʒmsȂ)
+				if (SpriteNumberUMap.exist(GroupNo(), ImageNo()) || SkippedSpriteNumberUMap.exist(GroupNo(), ImageNo())) {
+					AddDuplicationCount();
+					if (Accepted) { T_ErrorHandle::Instance().SetError(ErrorMessage::DuplicateSpriteNumber, GroupNo(), ImageNo()); }
+					return;
+				}
+
+				// Lpbg̎QƐƃN摜ReadSpriteBinaryƓ
+				T_EntrySource Entry = {};
+				if (PCXDataSize()) {
+					Entry.DataOffset = static_cast<uint32_t>(File.tellg());
+					Entry.DataSize = PCXDataSize();
+					Entry.OwnPalette = (!LoadNo || !SharedPal());
+					Entry.Root = static_cast<int32_t>(EntryList.size());
+					if (Entry.OwnPalette) {
+						Entry.PaletteOffset = Entry.DataOffset + (std::max<uint32_t>)(Entry.DataSize, SFFFormat::kSFFPaletteSize) - SFFFormat::kSFFPaletteSize;
+					}
+					else if (!EntryList.empty()) {
+						Entry.PaletteOffset = (GroupNo() == 0 && ImageNo() == 0 ? EntryList.front() : EntryList.back()).PaletteOffset;
+					}
+				}
+				else if (const int32_t SourceIndex = SpriteIndex() - DuplicationCount(); 0 <= SourceIndex && static_cast<size_t>(SourceIndex) < EntryList.size() && EntryList[SourceIndex].Root >= 0) {
+					Entry = EntryList[EntryList[SourceIndex].Root];
+				}
+				EntryList.emplace_back(Entry);
+
+				int32_t IndexListNumber = -1;
+				if (Accepted && Entry.Root >= 0) {
+					IndexListNumber = ResolveEntry(EntryList[Entry.Root], kReloadBaseData, SpriteDataUMap, SFFBinaryData);
+				}
+				if (IndexListNumber < 0) {
+					SkippedSpriteNumberUMap.Register(GroupNo(), ImageNo());
+					return;
+				}
+				SpriteNumberUMap.Register(GroupNo(), ImageNo());
+				SFFBinaryData.AddDataList(static_cast<ksize_t>(IndexListNumber), AxisX(), AxisY(), GroupNo(), ImageNo());
+			}
+
+			void InitLoadSFFSubHeader() {
+				File.seekg(File.SubHeaderStart());
+			}
+
+			[[nodiscard]] bool CheckReadError() { // f[^̖ɓBorAhXsȒl
+				return !NextAddress() || NextAddress() < File.tellg();
+			}
+
+			[[nodiscard]] bool ReadSubHeader() {
+				constexpr unsigned long long SkipSize = SFFFormat::kFileLength - sizeof(buffer);
+				File.read(reinterpret_cast<char*>(&buffer), sizeof(buffer));
+				File.seekg(SkipSize, std::ios::cur); // f[^]XLbv(XvCgoCif[^܂őΈړ)
+				return CheckReadError();
+			}
+
+		public:
+			[[nodiscard]] uint32_t NextAddress() const noexcept { return DecodeBinary::UInt32LE(&buffer[0]); }
+			[[nodiscard]] uint32_t PCXDataSize() const noexcept { return DecodeBinary::UInt32LE(&buffer[4]); }
+			[[nodiscard]] uint16_t AxisX() const noexcept { return DecodeBinary::UInt16LE(&buffer[8]); }
+			[[nodiscard]] uint16_t AxisY() const noexcept { return DecodeBinary::UInt16LE(&buffer[10]); }
+			[[nodiscard]] uint16_t GroupNo() const noexcept { return DecodeBinary::UInt16LE(&buffer[12]); }
+			[[nodiscard]] uint16_t ImageNo() const noexcept { return DecodeBinary::UInt16LE(&buffer[14]); }
+			[[nodiscard]] uint16_t SpriteIndex() const noexcept { return DecodeBinary::UInt16LE(&buffer[16]); }
+			[[nodiscard]] unsigned char SharedPal() const noexcept { return buffer[18]; }
+			[[nodiscard]] bool CheckError() { return false; } // vȂ̂ŕۗ
+			[[nodiscard]] int32_t DuplicationCount() const noexcept { return DuplicationCount_; }
+
+		public:
+			T_LoadSFFSubHeader(T_LoadSFFHeader& LoadSFFHeader, T_ReloadBaseData* ReloadBaseData = nullptr, const T_LoadFilter* LoadFilter = nullptr)
+				: File(LoadSFFHeader), kReloadBaseData(ReloadBaseData), kLoadFilter(LoadFilter && !LoadFilter->empty() ? LoadFilter : nullptr) {
+				InitLoadSFFSubHeader();
+			}
+
+			[[nodiscard]] bool ReadSpriteBinary(int32_t LoadNo, T_UnorderedMap& SpriteNumberUMap, T_UnorderedMap& SpriteDataUMap, T_SFFBinaryData& SFFBinaryData) {
+				if (ReadSubHeader()) { return true; }
+
+				if (kLoadFilter) {
+					ReadFilteredSpriteBinary(LoadNo, SpriteNumberUMap, SpriteDataUMap, SFFBinaryData);
+					File.seekg(NextAddress());
+					return false;
+				}
+
+				// 擾摜ԍd
+				if (SpriteNumberUMap.exist(GroupNo(), ImageNo())) {
+					AddDuplicationCount();
+					T_ErrorHandle::Instance().SetError(ErrorMessage::DuplicateSpriteNumber, GroupNo(), ImageNo());
+					File.seekg(NextAddress());
+					return false;
+				}
+
+				SpriteNumberUMap.Register(GroupNo(), ImageNo());
+				ksize_t PaletteListIndex = 0;
+				ksize_t IndexListNumber = 0;
+
+				// 摜f[^
+				if (PCXDataSize()) {
+					bool FoundPaletteData = false;
+					const bool SharedPal_ = (!LoadNo ? false : !!SharedPal()); // 擪摜͌ŗLpbgƂĈ
+
+					// 摜f[^ꎞۑ(ŗLpbgȂ摜f[^768Byte(pbgf[^)O)
+					const uint32_t DataOffset = static_cast<uint32_t>(File.tellg());
+					const int32_t BaseSpriteListIndex = ReadSpriteData(static_cast<size_t>(PCXDataSize()) - (!SharedPal_ ? SFFFormat::kSFFPaletteSize : 0), kReloadBaseData);
+
+					if (SharedPal_) {
+						FoundPaletteData = true;
+						// 摜ԍ(0,0)̏ꍇ擪摜̃pbgKp
+						// łȂΑO摜̃pbgp
+						if (GroupNo() == 0 && ImageNo() == 0) {
+							PaletteListIndex = 0;
+						}
+						else {
+							PaletteListIndex = SFFBinaryData.IndexList(SFFBinaryData.DataList().back().IndexListNumber()).PaletteIndex();
+						}
+					}
+					else {
+						// pbgf[^ꎞۑ
+						File.read(reinterpret_cast<char*>(LoadPaletteData.data()), SFFFormat::kSFFPaletteSize);
+
+						// pbgf[^d`FbN(̃pbgf[^̏ꍇ̓CfbNXw)
+						PaletteListIndex = SFFBinaryData.FindPalette(LoadPaletteData.data());
+						FoundPaletteData = (PaletteListIndex < SFFBinaryData.NumPalette());
+
+						// VKpbg̏ꍇ̓pbgf[^i[
+						if (!FoundPaletteData) {
+							PaletteListIndex = SFFBinaryData.NumPalette();
+							SFFBinaryData.AddPalette(LoadPaletteData);
+						}
+						SFFBinaryData.AddFilePalette(!FoundPaletteData);
+					}
+
+					IndexListNumber = AddSpriteData(PaletteListIndex, FoundPaletteData, DataOffset, BaseSpriteListIndex, kReloadBaseData, SpriteDataUMap, SFFBinaryData);
+				}
+				else { // PCXDataȂȂRs[̃XvCgCfbNXw
+					IndexListNumber = SFFBinaryData.DataList(SpriteIndex() - DuplicationCount()).IndexListNumber();
+				}
+				SFFBinaryData.AddDataList(IndexListNumber, AxisX(), AxisY(), GroupNo(), ImageNo());
+
+				File.seekg(NextAddress());
+
+				return false;
+			}
+		};
+
+		// SFFt@CP̂̌،
+		struct T_VerifyResult {
+		private:
+			std::string FilePath_ = {};
+			int32_t ErrorID_ = -1;
+			int32_t NumSprite_ = 0;
+			int32_t NumBrokenSprite_ = 0;
+
+		public:
+			/**
+			* @brief ،ʂ̔
+			*
+			* @t@C`ƑSẲ摜f[^ɖ肪ȂԂ܂
+			*
+			* @return bool 茋 (false = jFtrue = Ȃ)
+			*/
+			bool Verified() const noexcept { return ErrorID_ < 0 && NumBrokenSprite_ == 0; }
+
+			/**
+			* @brief ؂t@C̃pX擾
+			*
+			* @return const std::string& FilePath t@CpX
+			*/
+			const std::string& FilePath() const noexcept { return FilePath_; }
+
+			/**
+			* @brief t@C`̃G[ID擾
+			*
+			* @t@C`ɖ肪Ȃꍇ -1 Ԃ܂
+			*
+			* @return int32_t ErrorID G[ID (SFFError::ErrorID)
+			*/
+			int32_t ErrorID() const noexcept { return ErrorID_; }
+
+			/**
+			* @brief ؂摜擾
+			*
+			* @摜f[^ȂN摜͊܂݂܂
+			*
+			* @return int32_t NumSprite ؂摜
+			*/
+			int32_t NumSprite() const noexcept { return NumSprite_; }
+
+			/**
+			* @brief jĂ摜擾
+			*
+			* @return int32_t NumBrokenSprite jĂ摜
+			*/
+			int32_t NumBrokenSprite() const noexcept { return NumBrokenSprite_; }
+
+			void ErrorID(int32_t value) noexcept { ErrorID_ = value; }
+			void AddSprite(bool Verified) noexcept {
+				++NumSprite_;
+				NumBrokenSprite_ += (Verified ? 0 : 1);
+			}
+
+		public:
+			T_VerifyResult() = default;
+
+			T_VerifyResult(const std::string& FilePath) : FilePath_(FilePath) {}
+		};
+
+		// SFFt@C̐(f[^̊i[͍sȂ)
+		// Xbh瓯Ɏs邽T_ErrorHandle͎gpʂ݂̂Ԃ
+		struct T_VerifySFFFile {
+		private:
+			T_BufferedFileReader File = {};
+			unsigned char HeaderBuffer[33] = {};
+			unsigned char SubHeaderBuffer[19] = {};
+			std::vector<unsigned char> LoadSpriteData = {};
+			T_VerifyResult Result_ = {};
+
+			[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(HeaderBuffer), SFFFormat::kSignature.size()); }
+			[[nodiscard]] uint32_t Version() const noexcept { return DecodeBinary::UInt32BE(&HeaderBuffer[12]); }
+			[[nodiscard]] uint32_t NumImages() const noexcept { return DecodeBinary::UInt32LE(&HeaderBuffer[20]); }
+			[[nodiscard]] uint32_t SubHeaderStart() const noexcept { return DecodeBinary::UInt32LE(&HeaderBuffer[24]); }
+			[[nodiscard]] uint32_t FileLength() const noexcept { return DecodeBinary::UInt32LE(&HeaderBuffer[28]); }
+			[[nodiscard]] uint32_t NextAddress() const noexcept { return DecodeBinary::UInt32LE(&SubHeaderBuffer[0]); }
+			[[nodiscard]] uint32_t PCXDataSize() const noexcept { return DecodeBinary::UInt32LE(&SubHeaderBuffer[4]); }
+			[[nodiscard]] unsigned char SharedPal() const noexcept { return SubHeaderBuffer[18]; }
+
+			[[nodiscard]] bool CheckSFFFormat() {
+				File.read(reinterpret_cast<char*>(&HeaderBuffer), sizeof(HeaderBuffer));
+
+				if (Signature() != SFFFormat::kSignature) {
+					Result_.ErrorID(ErrorMessage::InvalidSFFSignature);
+					return true;
+				}
+				if (Version() == SFFFormat::kSFFV2Version) {
+					Result_.ErrorID(ErrorMessage::UnsupportedSFFv2Version);
+					return true;
+				}
+				if (Version() == SFFFormat::kSFFV2_1Version) {
+					Result_.ErrorID(ErrorMessage::UnsupportedSFFv2_1Version);
+					return true;
+				}
+				if (Version() != SFFFormat::kSFFV1Version ||
+					SubHeaderStart() != SFFFormat::kSubHeaderStart ||
+					FileLength() != SFFFormat::kFileLength) {
+					Result_.ErrorID(ErrorMessage::BrokenSFFFile);
+					return true;
+				}
+				return false;
+			}
+
+			void VerifySFFFile(const std::filesystem::path& FilePath) {
+				std::error_code ErrorCode = {};
+				const uintmax_t FileSize = std::filesystem::file_size(FilePath, ErrorCode);
+				if (ErrorCode) {
+					Result_.ErrorID(ErrorMessage::OpenSFFFileFailed);
+					return;
+				}
+				if (FileSize > UINT32_MAX) {
+					Result_.ErrorID(ErrorMessage::SFFFileSizeOver);
+					return;
+				}
+				File.open(FilePath, std::ios::binary);
+				if (!File.is_open()) {
+					Result_.ErrorID(ErrorMessage::OpenSFFFileFailed);
+					return;
+				}
+				if (CheckSFFFormat()) { return; }
+
+				File.seekg(SubHeaderStart());
+				for (uint32_t LoadNo = 0; LoadNo < NumImages(); ++LoadNo) {
+					constexpr unsigned long long SkipSize = SFFFormat::kFileLength - sizeof(SubHeaderBuffer);
+					File.read(reinterpret_cast<char*>(&SubHeaderBuffer), sizeof(SubHeaderBuffer));
+					File.seekg(SkipSize, std::ios::cur);
+					if (!File) {
+						Result_.ErrorID(ErrorMessage::BrokenSFFFile);
+						return;
+					}
+
+					// T_LoadSFFSubHeader::CheckReadErrorƓœǂݍ݂I
+					const uint64_t SpriteStart = static_cast<uint64_t>(File.tellg());
+					if (!NextAddress() || NextAddress() < SpriteStart) { break; }
+					if (NextAddress() > FileSize) {
+						Result_.ErrorID(ErrorMessage::BrokenSFFFile);
+						return;
+					}
+
+					if (PCXDataSize()) {
+						const bool SharedPal_ = (!LoadNo ? false : !!SharedPal()); // 擪摜͌ŗLpbgƂĈ
+						const uint32_t PaletteSize = (!SharedPal_ ? SFFFormat::kSFFPaletteSize : 0);
+
+						if (PCXDataSize() < PaletteSize || SpriteStart + PCXDataSize() > FileSize) {
+							Result_.AddSprite(false);
+						}
+						else {
+							LoadSpriteData.resize(static_cast<size_t>(PCXDataSize()) - PaletteSize);
+							File.read(reinterpret_cast<char*>(LoadSpriteData.data()), LoadSpriteData.size());
+							Result_.AddSprite(File.good() && T_VerifySpriteBinary(LoadSpriteData.data(), static_cast<ksize_t>(LoadSpriteData.size())).Verified());
+						}
+					}
+					File.clear();
+					File.seekg(NextAddress());
+				}
+			}
+
+		public:
+			T_VerifySFFFile(const std::filesystem::path& FilePath) : Result_(FilePath.string()) {
+				VerifySFFFile(FilePath);
+			}
+
+			[[nodiscard]] const T_VerifyResult& Result() const noexcept {
+				return Result_;
+			}
+		};
+
+		// J^OSFFt@CPʂ̏
+		struct T_CatalogFile {
+		private:
+			std::string FilePath_ = {};
+			uint64_t FileSize_ = 0;
+			int64_t WriteTime_ = 0;
+			uint32_t FirstEntry_ = 0;
+			uint32_t NumEntry_ = 0;
+			int32_t ErrorID_ = -1;
+
+		public:
+			/**
+			* @brief t@C̃pX擾
+			*
+			* @return const std::string& FilePath t@CpX
+			*/
+			const std::string& FilePath() const noexcept { return FilePath_; }
+
+			/**
+			* @brief t@CTCY擾
+			*
+			* @return uint64_t FileSize ̃t@CTCY
+			*/
+			uint64_t FileSize() const noexcept { return FileSize_; }
+
+			/**
+			* @brief ŏIXV擾
+			*
+			* @std::filesystem::file_time_type̓lł(̔Ɏgp܂)
+			*
+			* @return int64_t WriteTime ̍ŏIXV
+			*/
+			int64_t WriteTime() const noexcept { return WriteTime_; }
+
+			/**
+			* @brief t@C̐擪̉摜̃CfbNX擾
+			*
+			* @t@C̉摜 FirstEntry  NumEntry AĊi[Ă܂
+			*
+			* @return uint32_t FirstEntry 擪̉摜̃CfbNX
+			*/
+			uint32_t FirstEntry() const noexcept { return FirstEntry_; }
+
+			/**
+			* @brief t@C̉摜擾
+			*
+			* @return uint32_t NumEntry 摜 (dԍ̉摜)
+			*/
+			uint32_t NumEntry() const noexcept { return NumEntry_; }
+
+			/**
+			* @brief t@C`̃G[ID擾
+			*
+			* @t@C`ɖ肪Ȃꍇ -1 Ԃ܂
+			*
+			* @G[t@C̓G[܂łɑ摜݂̂܂
+			*
+			* @return int32_t ErrorID G[ID (SFFError::ErrorID)
+			*/
+			int32_t ErrorID() const noexcept { return ErrorID_; }
+
+			void FirstEntry(uint32_t value) noexcept { FirstEntry_ = value; }
+			void NumEntry(uint32_t value) noexcept { NumEntry_ = value; }
+			void ErrorID(int32_t value) noexcept { ErrorID_ = value; }
+
+		public:
+			T_CatalogFile() = default;
+
+			T_CatalogFile(const std::string& FilePath, uint64_t FileSize, int64_t WriteTime)
+				: FilePath_(FilePath), FileSize_(FileSize), WriteTime_(WriteTime) {
+			}
+		};
+
+		// J^Ỏ摜Pʂ̏
+		struct T_CatalogEntry {
+		private:
+			uint32_t FileIndex_ = 0;
+			int32_t SpriteNumber_ = 0;	// groupNo(65535) imageNo(65535)
+			int32_t SpriteAxis_ = 0;	// axisXY(-32768`32767)
+			uint16_t Width_ = 0;
+			uint16_t Height_ = 0;
+			uint32_t DataSize_ = 0;
+			uint64_t Hash_ = 0;
+			bool Linked_ = false;
+
+		public:
+			/**
+			* @brief 摜܂܂t@C̃CfbNX擾
+			*
+			* @return uint32_t FileIndex t@C̃CfbNX (SFFCatalog::GetFile)
+			*/
+			uint32_t FileIndex() const noexcept { return FileIndex_; }
+
+			/**
+			* @brief O[vԍ擾
+			*
+			* @return int32_t GroupNo O[vԍ
+			*/
+			int32_t GroupNo() const noexcept { return Convert::DecodeSpriteGroupNo(SpriteNumber_); }
+
+			/**
+			* @brief C[Wԍ擾
+			*
+			* @return int32_t ImageNo C[Wԍ
+			*/
+			int32_t ImageNo() const noexcept { return Convert::DecodeSpriteImageNo(SpriteNumber_); }
+
+			/**
+			* @brief WX擾
+			*
+			* @return int32_t AxisX WX
+			*/
+			int32_t AxisX() const noexcept { return Convert::DecodeSpriteAxisX(SpriteAxis_); }
+
+			/**
+			* @brief WY擾
+			*
+			* @return int32_t AxisY WY
+			*/
+			int32_t AxisY() const noexcept { return Convert::DecodeSpriteAxisY(SpriteAxis_); }
+
+			/**
+			* @brief 摜̕擾
+			*
+			* @摜f[^Ăꍇ 0 Ԃ܂
+			*
+			* @return uint16_t Width 摜̕
+			*/
+			uint16_t Width() const noexcept { return Width_; }
+
+			/**
+			* @brief 摜̍擾
+			*
+			* @摜f[^Ăꍇ 0 Ԃ܂
+			*
+			* @return uint16_t Height 摜̍
+			*/
+			uint16_t Height() const noexcept { return Height_; }
+
+			/**
+			* @brief 摜f[^(PCX)̃oCg擾
+			*
+			* @pbgf[^͊܂݂܂B摜f[^Ăꍇ 0 Ԃ܂
+			*
+			* @return uint32_t DataSize 摜f[^̃oCg
+			*/
+			uint32_t DataSize() const noexcept { return DataSize_; }
+
+			/**
+			* @brief 摜f[^(PCX)̃nbVl擾
+			*
+			* @摜f[^̃oCgFNV-1a(64bit)ł
+			*
+			* @return uint64_t Hash nbVl
+			*/
+			uint64_t Hash() const noexcept { return Hash_; }
+
+			/**
+			* @brief N摜擾
+			*
+			* @N摜̉摜TCYEoCgEnbVl̓N̉摜̒lł
+			*
+			* @return bool 茋 (false = 摜f[^Ftrue = N摜)
+			*/
+			bool Linked() const noexcept { return Linked_; }
+
+			[[nodiscard]] int32_t SpriteNumber() const noexcept { return SpriteNumber_; }
+			[[nodiscard]] int32_t SpriteAxis() const noexcept { return SpriteAxis_; }
+			void FileIndex(uint32_t value) noexcept { FileIndex_ = value; }
+
+		public:
+			T_CatalogEntry() = default;
+
+			T_CatalogEntry(int32_t SpriteNumber, int32_t SpriteAxis, uint16_t Width, uint16_t Height, uint32_t DataSize, uint64_t Hash, bool Linked) noexcept
+				: SpriteNumber_(SpriteNumber), SpriteAxis_(SpriteAxis), Width_(Width), Height_(Height), DataSize_(DataSize), Hash_(Hash), Linked_(Linked) {
+			}
+		};
+
+		// SFFt@C̃wb_[ƃTuwb_[݂̂HăJ^OW(f[^̊i[͍sȂ)
+		// Xbh瓯Ɏs邽T_ErrorHandle͎gpʂ݂̂Ԃ
+		struct T_ScanSFFFile {
+		private:
+			T_BufferedFileReader File = {};
+			unsigned char HeaderBuffer[33] = {};
+			unsigned char SubHeaderBuffer[19] = {};
+			std::vector<unsigned char> LoadSpriteData = {};
+			std::array<unsigned char, SFFFormat::kSFFPaletteSize> LoadPaletteData = {};
+			std::vector<T_CatalogEntry> EntryList_ = {};
+			std::vector<uint64_t> PaletteHashList_ = {}; // EntryList_Ɠ(ScanPalettew莞̂)
+			const bool kScanPalette;
+			int32_t ErrorID_ = -1;
+
+			[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(HeaderBuffer), SFFFormat::kSignature.size()); }
+			[[nodiscard]] uint32_t Version() const noexcept { return DecodeBinary::UInt32BE(&HeaderBuffer[12]); }
+			[[nodiscard]] uint32_t NumImages() const noexcept { return DecodeBinary::UInt32LE(&HeaderBuffer[20]); }
+			[[nodiscard]] uint32_t SubHeaderStart() const noexcept { return DecodeBinary::UInt32LE(&HeaderBuffer[24]); }
+			[[nodiscard]] uint32_t FileLength() const noexcept { return DecodeBinary::UInt32LE(&HeaderBuffer[28]); }
+			[[nodiscard]] uint32_t NextAddress() const noexcept { return DecodeBinary::UInt32LE(&SubHeaderBuffer[0]); }
+			[[nodiscard]] uint32_t PCXDataSize() const noexcept { return DecodeBinary::UInt32LE(&SubHeaderBuffer[4]); }
+			[[nodiscard]] uint16_t AxisX() const noexcept { return DecodeBinary::UInt16LE(&SubHeaderBuffer[8]); }
+			[[nodiscard]] uint16_t AxisY() const noexcept { return DecodeBinary::UInt16LE(&SubHeaderBuffer[10]); }
+			[[nodiscard]] uint16_t GroupNo() const noexcept { return DecodeBinary::UInt16LE(&SubHeaderBuffer[12]); }
+			[[nodiscard]] uint16_t ImageNo() const noexcept { return DecodeBinary::UInt16LE(&SubHeaderBuffer[14]); }
+			[[nodiscard]] uint16_t SpriteIndex() const noexcept { return DecodeBinary::UInt16LE(&SubHeaderBuffer[16]); }
+			[[nodiscard]] unsigned char SharedPal() const noexcept { return SubHeaderBuffer[18]; }
+
+			[[nodiscard]] bool CheckSFFFormat() {
+				File.read(reinterpret_cast<char*>(&HeaderBuffer), sizeof(HeaderBuffer));
+
+				if (Signature() != SFFFormat::kSignature) {
+					ErrorID_ = ErrorMessage::InvalidSFFSignature;
+					return true;
+				}
+				if (Version() == SFFFormat::kSFFV2Version) {
+					ErrorID_ = ErrorMessage::UnsupportedSFFv2Version;
+					return true;
+				}
+				if (Version() == SFFFormat::kSFFV2_1Version) {
+					ErrorID_ = ErrorMessage::UnsupportedSFFv2_1Version;
+					return true;
+				}
+				if (Version() != SFFFormat::kSFFV1Version ||
+					SubHeaderStart() != SFFFormat::kSubHeaderStart ||
+					FileLength() != SFFFormat::kFileLength) {
+					ErrorID_ = ErrorMessage::BrokenSFFFile;
+					return true;
+				}
+				return false;
+			}
+
+			// Lpbg̎QƐT_LoadSFFSubHeader::ReadSpriteBinaryƓ
+			[[nodiscard]] uint64_t SharedPaletteHash() const noexcept {
+				if (PaletteHashList_.empty()) { return 0; }
+				return (GroupNo() == 0 && ImageNo() == 0 ? PaletteHashList_.front() : PaletteHashList_.back());
+			}
+
+			// 摜ԍ̏dƃN摜T_LoadSFFSubHeader::ReadSpriteBinaryƓ
+			void ScanSFFFile(const std::filesystem::path& FilePath, uint64_t FileSize) {
+				if (FileSize > UINT32_MAX) {
+					ErrorID_ = ErrorMessage::SFFFileSizeOver;
+					return;
+				}
+				File.open(FilePath, std::ios::binary);
+				if (!File.is_open()) {
+					ErrorID_ = ErrorMessage::OpenSFFFileFailed;
+					return;
+				}
+				if (CheckSFFFormat()) { return; }
+
+				std::unordered_map<int32_t, int32_t> SpriteNumberUMap = {};
+				int32_t DuplicationCount = 0;
+				File.seekg(SubHeaderStart());
+				for (uint32_t LoadNo = 0; LoadNo < NumImages(); ++LoadNo) {
+					constexpr unsigned long long SkipSize = SFFFormat::kFileLength - sizeof(SubHeaderBuffer);
+					File.read(reinterpret_cast<char*>(&SubHeaderBuffer), sizeof(SubHeaderBuffer));
+					File.seekg(SkipSize, std::ios::cur);
+					if (!File) {
+						ErrorID_ = ErrorMessage::BrokenSFFFile;
+						return;
+					}
+
+					const uint64_t SpriteStart = static_cast<uint64_t>(File.tellg());
+					if (!NextAddress() || NextAddress() < SpriteStart) { break; }
+					if (NextAddress() > FileSize) {
+						ErrorID_ = ErrorMessage::BrokenSFFFile;
+						return;
+					}
+
+					const int32_t SpriteNumber = Convert::EncodeIntHalf(GroupNo(), ImageNo());
+					const int32_t SpriteAxis = Convert::EncodeSpriteAxis(AxisX(), AxisY());
+					if (!SpriteNumberUMap.emplace(SpriteNumber, static_cast<int32_t>(EntryList_.size())).second) {
+						++DuplicationCount;
+					}
+					else if (PCXDataSize()) {
+						const bool SharedPal_ = (!LoadNo ? false : !!SharedPal()); // 擪摜͌ŗLpbgƂĈ
+						const uint32_t PaletteSize = (!SharedPal_ ? SFFFormat::kSFFPaletteSize : 0);
+
+						if (PCXDataSize() < PaletteSize || SpriteStart + PCXDataSize() > FileSize) {
+							if (kScanPalette) { PaletteHashList_.push_back(0); }
+							EntryList_.emplace_back(T_CatalogEntry(SpriteNumber, SpriteAxis, 0, 0, 0, 0, false));
+						}
+						else {
+							LoadSpriteData.resize(static_cast<size_t>(PCXDataSize()) - PaletteSize);
+							File.read(reinterpret_cast<char*>(LoadSpriteData.data()), LoadSpriteData.size());
+							const bool Valid = File.good() && LoadSpriteData.size() > SFFFormat::kSpriteBinaryPixelOffbits;
+							if (kScanPalette) {
+								uint64_t PaletteHash = SharedPaletteHash();
+								if (!SharedPal_) {
+									File.read(reinterpret_cast<char*>(LoadPaletteData.data()), LoadPaletteData.size());
+									PaletteHash = (File.good() ? HashBinary::FNV1a64(LoadPaletteData.data(), LoadPaletteData.size()) : 0);
+								}
+								PaletteHashList_.push_back(PaletteHash);
+							}
+							EntryList_.emplace_back(T_CatalogEntry(SpriteNumber, SpriteAxis
+								, (Valid ? static_cast<uint16_t>(1 + DecodeBinary::UInt16LE(&LoadSpriteData[8])) : 0)
+								, (Valid ? static_cast<uint16_t>(1 + DecodeBinary::UInt16LE(&LoadSpriteData[10])) : 0)
+								, (Valid ? static_cast<uint32_t>(LoadSpriteData.size()) : 0)
+								, (Valid ? HashBinary::FNV1a64(LoadSpriteData.data(), LoadSpriteData.size()) : 0), false));
+						}
+					}
+					else { // N͏dԍ摜̕тŎw
+						const int32_t LinkIndex = SpriteIndex() - DuplicationCount;
+						if (LinkIndex >= 0 && static_cast<size_t>(LinkIndex) < EntryList_.size()) {
+							const T_CatalogEntry& Link = EntryList_[LinkIndex];
+							if (kScanPalette) { PaletteHashList_.push_back(PaletteHashList_[LinkIndex]); }
+							EntryList_.emplace_back(T_CatalogEntry(SpriteNumber, SpriteAxis, Link.Width(), Link.Height(), Link.DataSize(), Link.Hash(), true));
+						}
+						else {
+							if (kScanPalette) { PaletteHashList_.push_back(0); }
+							EntryList_.emplace_back(T_CatalogEntry(SpriteNumber, SpriteAxis, 0, 0, 0, 0, true));
+						}
+					}
+					File.clear();
+					File.seekg(NextAddress());
+				}
+			}
+
+		public:
+			// ScanPalettew肵ꍇ͉摜Ƃ̃pbgf[^̃nbVlW
+			T_ScanSFFFile(const std::filesystem::path& FilePath, uint64_t FileSize, bool ScanPalette = false) : kScanPalette(ScanPalette) {
+				ScanSFFFile(FilePath, FileSize);
+			}
+
+			[[nodiscard]] std::vector<T_CatalogEntry>& EntryList() noexcept { return EntryList_; }
+			[[nodiscard]] const std::vector<uint64_t>& PaletteHashList() const noexcept { return PaletteHashList_; }
+			[[nodiscard]] int32_t ErrorID() const noexcept { return ErrorID_; }
+		};
+
+		// SFFt@C̉摜̈ꗗ
+		struct T_SFFCatalog {
+		private:
+			inline static constexpr std::string_view kSignature = "SAESFFCT";
+			inline static constexpr uint32_t kVersion = 1;
+			inline static constexpr size_t kHeaderSize = 8 + 4 + 4 + 4;
+			inline static constexpr size_t kFileInfoSize = 2 + 8 + 8 + 4 + 4 + 4; // pX
+			inline static constexpr size_t kEntrySize = 4 + 4 + 4 + 2 + 2 + 4 + 8 + 1;
+
+			std::vector<T_CatalogFile> FileList_ = {};
+			std::vector<T_CatalogEntry> EntryList_ = {};
+			std::vector<uint32_t> NumberIndex_ = {};	// 摜ԍ̃CfbNX
+			std::vector<uint32_t> HashIndex_ = {};		// nbVlƃoCg̏̃CfbNX
+
+			[[nodiscard]] bool NumberLess(uint32_t Left, uint32_t Right) const noexcept {
+				const uint32_t LeftNumber = static_cast<uint32_t>(EntryList_[Left].SpriteNumber());
+				const uint32_t RightNumber = static_cast<uint32_t>(EntryList_[Right].SpriteNumber());
+				return (LeftNumber != RightNumber ? LeftNumber < RightNumber : Left < Right);
+			}
+
+			[[nodiscard]] bool HashLess(uint32_t Left, uint32_t Right) const noexcept {
+				const T_CatalogEntry& LeftEntry = EntryList_[Left];
+				const T_CatalogEntry& RightEntry = EntryList_[Right];
+				if (LeftEntry.Hash() != RightEntry.Hash()) { return LeftEntry.Hash() < RightEntry.Hash(); }
+				if (LeftEntry.DataSize() != RightEntry.DataSize()) { return LeftEntry.DataSize() < RightEntry.DataSize(); }
+				return Left < Right;
+			}
+
+			void BuildIndex() {
+				NumberIndex_.resize(EntryList_.size());
+				for (uint32_t index = 0; index < NumberIndex_.size(); ++index) { NumberIndex_[index] = index; }
+				HashIndex_ = NumberIndex_;
+				std::sort(NumberIndex_.begin(), NumberIndex_.end(), [this](uint32_t Left, uint32_t Right) { return NumberLess(Left, Right); });
+				std::sort(HashIndex_.begin(), HashIndex_.end(), [this](uint32_t Left, uint32_t Right) { return HashLess(Left, Right); });
+			}
+
+		public:
+			/**
+			* @brief t@C擾
+			*
+			* @return size_t NumFile J^Õt@C
+			*/
+			size_t NumFile() const noexcept { return FileList_.size(); }
+
+			/**
+			* @brief 摜擾
+			*
+			* @return size_t NumEntry J^ȎSt@C̉摜
+			*/
+			size_t NumEntry() const noexcept { return EntryList_.size(); }
+
+			/**
+			* @brief t@C擾
+			*
+			* @t@C̓pXɕł܂
+			*
+			* @param uint32_t FileIndex t@C̃CfbNX (0 ` NumFile - 1)
+			* @return const SFFCatalog::File& File t@C
+			*/
+			const T_CatalogFile& GetFile(uint32_t FileIndex) const noexcept { return FileList_[FileIndex]; }
+
+			/**
+			* @brief 摜擾
+			*
+			* @param uint32_t EntryIndex 摜̃CfbNX (0 ` NumEntry - 1)
+			* @return const SFFCatalog::Entry& Entry 摜
+			*/
+			const T_CatalogEntry& GetEntry(uint32_t EntryIndex) const noexcept { return EntryList_[EntryIndex]; }
+
+			/**
+			* @brief wpX̃t@C̃CfbNX
+			*
+			* @pX͑Ɠ\LŎw肵Ă
+			*
+			* @param const std::string& FilePath t@CpX
+			* @return int32_t FileIndex t@C̃CfbNX (Ȃꍇ -1)
+			*/
+			int32_t FindFile(const std::string& FilePath) const {
+				const auto it = std::lower_bound(FileList_.begin(), FileList_.end(), FilePath, [](const T_CatalogFile& File, const std::string& Path) { return File.FilePath() < Path; });
+				return (it != FileList_.end() && it->FilePath() == FilePath ? static_cast<int32_t>(it - FileList_.begin()) : -1);
+			}
+
+			/**
+			* @brief wԍ̉摜St@C猟
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @param int32_t ImageNo C[Wԍ
+			* @return std::vector<uint32_t> EntryIndexList 摜̃CfbNX (t@C)
+			*/
+			std::vector<uint32_t> Find(int32_t GroupNo, int32_t ImageNo) const {
+				const uint32_t SpriteNumber = static_cast<uint32_t>(Convert::EncodeIntHalf(GroupNo, ImageNo));
+				const auto Begin = std::lower_bound(NumberIndex_.begin(), NumberIndex_.end(), SpriteNumber, [this](uint32_t index, uint32_t Number) { return static_cast<uint32_t>(EntryList_[index].SpriteNumber()) < Number; });
+				const auto End = std::upper_bound(Begin, NumberIndex_.end(), SpriteNumber, [this](uint32_t Number, uint32_t index) { return Number < static_cast<uint32_t>(EntryList_[index].SpriteNumber()); });
+				return std::vector<uint32_t>(Begin, End);
+			}
+
+			/**
+			* @brief 摜f[^摜St@C猟
+			*
+			* @摜f[^(PCX)̃nbVlƃoCgv摜Ԃ܂(w肵摜g͊܂݂܂)
+			*
+			* @t@C̃N摜܂܂܂B摜f[^Ă摜͏ɋ̔zԂ܂
+			*
+			* @param uint32_t EntryIndex 摜̃CfbNX
+			* @return std::vector<uint32_t> EntryIndexList 摜̃CfbNX (t@C)
+			*/
+			std::vector<uint32_t> FindDuplicate(uint32_t EntryIndex) const {
+				std::vector<uint32_t> Result = {};
+				if (EntryIndex >= EntryList_.size() || !EntryList_[EntryIndex].DataSize()) { return Result; }
+				const T_CatalogEntry& Entry = EntryList_[EntryIndex];
+				auto it = std::lower_bound(HashIndex_.begin(), HashIndex_.end(), EntryIndex, [&](uint32_t index, uint32_t) {
+					const T_CatalogEntry& Other = EntryList_[index];
+					return (Other.Hash() != Entry.Hash() ? Other.Hash() < Entry.Hash() : Other.DataSize() < Entry.DataSize());
+				});
+				for (; it != HashIndex_.end() && EntryList_[*it].Hash() == Entry.Hash() && EntryList_[*it].DataSize() == Entry.DataSize(); ++it) {
+					if (*it != EntryIndex) { Result.push_back(*it); }
+				}
+				return Result;
+			}
+
+			/**
+			* @brief wpXSFFt@C𑖍
+			*
+			* @w肵t@CA܂̓tH_ȉ̑SĂ.sfft@C(gq̑啶͋ʂȂ)̃wb_[ƃTuwb_[ɑAJ^O蒼܂
+			*
+			* @t@CTCYƍŏIXVȎ(܂Loadœǂݍ񂾃J^O)Ɠt@C͑ȗ܂
+			*
+			* @̃G[SFFConfig::SetThrowError̐ݒɊւ炸t@CƂErrorIDł̂ݒʒm܂
+			*
+			* @param const std::string& Path Ώۂ̃t@C܂̓tH_̃pX
+			* @return int32_t NumScanned ۂɑt@C
+			*/
+			int32_t Scan(const std::string& Path) {
+				const std::vector<std::filesystem::path> FilePathList = T_SFFFileSearch::Collect(Path);
+
+				std::vector<T_CatalogFile> FileList = {};
+				FileList.reserve(FilePathList.size());
+				for (const auto& FilePath : FilePathList) {
+					std::error_code ErrorCode = {};
+					const uintmax_t FileSize = std::filesystem::file_size(FilePath, ErrorCode);
+					const auto WriteTime = std::filesystem::last_write_time(FilePath, ErrorCode);
+					FileList.emplace_back(T_CatalogFile(FilePath.string(), (ErrorCode ? 0 : FileSize), (ErrorCode ? 0 : static_cast<int64_t>(WriteTime.time_since_epoch().count()))));
+					if (ErrorCode) { FileList.back().ErrorID(ErrorMessage::OpenSFFFileFailed); }
+				}
+				std::sort(FileList.begin(), FileList.end(), [](const T_CatalogFile& Left, const T_CatalogFile& Right) { return Left.FilePath() < Right.FilePath(); });
+
+				// ύX̂Ȃt@C͑Ǒʂp
+				std::vector<std::vector<T_CatalogEntry>> EntryList(FileList.size());
+				std::vector<size_t> ScanList = {};
+				for (size_t FileIndex = 0; FileIndex < FileList.size(); ++FileIndex) {
+					T_CatalogFile& File = FileList[FileIndex];
+					if (File.ErrorID() >= 0) { continue; }
+					const int32_t OldFileIndex = FindFile(File.FilePath());
+					if (OldFileIndex >= 0 && FileList_[OldFileIndex].FileSize() == File.FileSize() && FileList_[OldFileIndex].WriteTime() == File.WriteTime()) {
+						const T_CatalogFile& OldFile = FileList_[OldFileIndex];
+						EntryList[FileIndex].assign(EntryList_.begin() + OldFile.FirstEntry(), EntryList_.begin() + OldFile.FirstEntry() + OldFile.NumEntry());
+						File.ErrorID(OldFile.ErrorID());
+					}
+					else {
+						ScanList.push_back(FileIndex);
+					}
+				}
+
+				// 傫t@C珇ɋ󂢂Xbh擾邱ƂŏԂ̕΂}
+				std::sort(ScanList.begin(), ScanList.end(), [&](size_t Left, size_t Right) { return FileList[Left].FileSize() > FileList[Right].FileSize(); });
+				T_ParallelFor::Run(ScanList.size(), [&](size_t index) {
+					const size_t FileIndex = ScanList[index];
+					T_ScanSFFFile ScanSFFFile(FileList[FileIndex].FilePath(), FileList[FileIndex].FileSize());
+					FileList[FileIndex].ErrorID(ScanSFFFile.ErrorID());
+					EntryList[FileIndex] = std::move(ScanSFFFile.EntryList());
+				});
+
+				// t@CɘA
+				EntryList_.clear();
+				for (size_t FileIndex = 0; FileIndex < FileList.size(); ++FileIndex) {
+					FileList[FileIndex].FirstEntry(static_cast<uint32_t>(EntryList_.size()));
+					FileList[FileIndex].NumEntry(static_cast<uint32_t>(EntryList[FileIndex].size()));
+					for (auto& Entry : EntryList[FileIndex]) {
+						Entry.FileIndex(static_cast<uint32_t>(FileIndex));
+						EntryList_.push_back(Entry);
+					}
+				}
+				FileList_ = std::move(FileList);
+				BuildIndex();
+				return static_cast<int32_t>(ScanList.size());
+			}
+
+			/**
+			* @brief J^Ot@C֕ۑ
+			*
+			* @ȍ~Loadœǂݍ݁Â݂𑖍邽߂Ɏgp܂
+			*
+			* @ŏIXV͎s̓l̂܂ܕۑ邽߁Ał̂ݎgpĂ
+			*
+			* @t@CpX65535Byte𒴂t@C܂ޏꍇ͕ۑ܂
+			*
+			* @param const std::string& FilePath ۑ̃t@CpX
+			* @return bool ۑ (false = sFtrue = )
+			*/
+			bool Save(const std::string& FilePath) const {
+				size_t BinarySize = kHeaderSize + kEntrySize * EntryList_.size();
+				for (const auto& File : FileList_) {
+					// t@CpX̒16bitŕۑ
+					if (File.FilePath().size() > UINT16_MAX) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::CatalogFilePathTooLong);
+						return false;
+					}
+					BinarySize += kFileInfoSize + File.FilePath().size();
+				}
+				std::vector<unsigned char> Binary(BinarySize);
+				unsigned char* Ptr = Binary.data();
+
+				std::memcpy(Ptr, kSignature.data(), kSignature.size());
+				EncodeBinary::UInt32LE(Ptr + 8, kVersion);
+				EncodeBinary::UInt32LE(Ptr + 12, static_cast<uint32_t>(FileList_.size()));
+				EncodeBinary::UInt32LE(Ptr + 16, static_cast<uint32_t>(EntryList_.size()));
+				Ptr += kHeaderSize;
+				for (const auto& File : FileList_) {
+					EncodeBinary::UInt16LE(Ptr, static_cast<uint16_t>(File.FilePath().size()));
+					std::memcpy(Ptr + 2, File.FilePath().data(), File.FilePath().size());
+					Ptr += 2 + File.FilePath().size();
+					EncodeBinary::UInt64LE(Ptr, File.FileSize());
+					EncodeBinary::UInt64LE(Ptr + 8, static_cast<uint64_t>(File.WriteTime()));
+					EncodeBinary::UInt32LE(Ptr + 16, File.FirstEntry());
+					EncodeBinary::UInt32LE(Ptr + 20, File.NumEntry());
+					EncodeBinary::UInt32LE(Ptr + 24, static_cast<uint32_t>(File.ErrorID()));
+					Ptr += kFileInfoSize - 2;
+				}
+				for (const auto& Entry : EntryList_) {
+					EncodeBinary::UInt32LE(Ptr, Entry.FileIndex());
+					EncodeBinary::UInt32LE(Ptr + 4, static_cast<uint32_t>(Entry.SpriteNumber()));
+					EncodeBinary::UInt32LE(Ptr + 8, static_cast<uint32_t>(Entry.SpriteAxis()));
+					EncodeBinary::UInt16LE(Ptr + 12, Entry.Width());
+					EncodeBinary::UInt16LE(Ptr + 14, Entry.Height());
+					EncodeBinary::UInt32LE(Ptr + 16, Entry.DataSize());
+					EncodeBinary::UInt64LE(Ptr + 20, Entry.Hash());
+					Ptr[28] = (Entry.Linked() ? 1 : 0);
+					Ptr += kEntrySize;
+				}
+
+				std::ofstream File(FilePath, std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateCatalogFileFailed);
+					return false;
+				}
+				File.write(reinterpret_cast<const char*>(Binary.data()), Binary.size());
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteCatalogFileFailed);
+					return false;
+				}
+				return true;
+			}
+
+			/**
+			* @brief ۑJ^Oǂݍ
+			*
+			* @ǂݍ݂Ɏsꍇ̓J^OύX܂
+			*
+			* @param const std::string& FilePath J^Ot@C̃pX
+			* @return bool ǂݍ݌ (false = sFtrue = )
+			*/
+			bool Load(const std::string& FilePath) {
+				std::ifstream File(FilePath, std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::OpenCatalogFileFailed);
+					return false;
+				}
+				const std::vector<unsigned char> Binary((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+				const unsigned char* Ptr = Binary.data();
+				const unsigned char* const EndPtr = Binary.data() + Binary.size();
+				auto Invalid = []() {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidCatalogFile);
+					return false;
+				};
+
+				if (Binary.size() < kHeaderSize || std::string_view(reinterpret_cast<const char*>(Ptr), kSignature.size()) != kSignature || DecodeBinary::UInt32LE(Ptr + 8) != kVersion) { return Invalid(); }
+				const uint32_t NumFile = DecodeBinary::UInt32LE(Ptr + 12);
+				const uint32_t NumEntry = DecodeBinary::UInt32LE(Ptr + 16);
+				Ptr += kHeaderSize;
+
+				std::vector<T_CatalogFile> FileList = {};
+				FileList.reserve((std::min)(static_cast<size_t>(NumFile), Binary.size() / kFileInfoSize));
+				for (uint32_t FileIndex = 0; FileIndex < NumFile; ++FileIndex) {
+					if (EndPtr - Ptr < 2) { return Invalid(); }
+					const size_t PathSize = DecodeBinary::UInt16LE(Ptr);
+					if (static_cast<size_t>(EndPtr - Ptr) < kFileInfoSize + PathSize) { return Invalid(); }
+					const std::string Path(reinterpret_cast<const char*>(Ptr + 2), PathSize);
+					Ptr += 2 + PathSize;
+					FileList.emplace_back(T_CatalogFile(Path, DecodeBinary::UInt64LE(Ptr), static_cast<int64_t>(DecodeBinary::UInt64LE(Ptr + 8))));
+					FileList.back().FirstEntry(DecodeBinary::UInt32LE(Ptr + 16));
+					FileList.back().NumEntry(DecodeBinary::UInt32LE(Ptr + 20));
+					FileList.back().ErrorID(static_cast<int32_t>(DecodeBinary::UInt32LE(Ptr + 24)));
+					if (static_cast<uint64_t>(FileList.back().FirstEntry()) + FileList.back().NumEntry() > NumEntry) { return Invalid(); }
+					Ptr += kFileInfoSize - 2;
+				}
+				if (static_cast<size_t>(EndPtr - Ptr) != static_cast<size_t>(NumEntry) * kEntrySize) { return Invalid(); }
+
+				std::vector<T_CatalogEntry> EntryList = {};
+				EntryList.reserve(NumEntry);
+				for (uint32_t EntryIndex = 0; EntryIndex < NumEntry; ++EntryIndex, Ptr += kEntrySize) {
+					EntryList.emplace_back(T_CatalogEntry(static_cast<int32_t>(DecodeBinary::UInt32LE(Ptr + 4)), static_cast<int32_t>(DecodeBinary::UInt32LE(Ptr + 8))
+						, DecodeBinary::UInt16LE(Ptr + 12), DecodeBinary::UInt16LE(Ptr + 14), DecodeBinary::UInt32LE(Ptr + 16), DecodeBinary::UInt64LE(Ptr + 20), Ptr[28] != 0));
+					EntryList.back().FileIndex(DecodeBinary::UInt32LE(Ptr));
+					if (EntryList.back().FileIndex() >= NumFile) { return Invalid(); }
+				}
+
+				FileList_ = std::move(FileList);
+				EntryList_ = std::move(EntryList);
+				BuildIndex();
+				return true;
+			}
+
+			/**
+			* @brief J^Ȍ
+			*/
+			void clear() {
+				FileList_.clear();
+				EntryList_.clear();
+				NumberIndex_.clear();
+				HashIndex_.clear();
+			}
+
+			/**
+			* @brief J^Ȏ݊mF
+			*
+			* @return bool 茋 (false = f[^݁Ftrue = f[^)
+			*/
+			bool empty() const noexcept { return FileList_.empty(); }
+
+		public:
+			using File = T_CatalogFile;
+			using Entry = T_CatalogEntry;
+
+			T_SFFCatalog() = default;
+		};
+
+		// 2SFFt@CԂ̉摜Pʂ̕ύXe
+		struct T_SFFDiffEntry {
+		public:
+			enum T_Change : uint8_t {
+				kAdded = 1 << 0,
+				kRemoved = 1 << 1,
+				kMoved = 1 << 2,
+				kAxisChanged = 1 << 3,
+				kPixelChanged = 1 << 4,
+				kPaletteChanged = 1 << 5,
+			};
+
+		private:
+			int32_t SpriteNumber_ = 0;		// ύX̉摜ԍ(폜ꂽ摜͕ύXO)
+			int32_t OldSpriteNumber_ = 0;	// ύXỎ摜ԍ(ԍ̕ύXȊOSpriteNumber_Ɠ)
+			int32_t SpriteAxis_ = 0;
+			int32_t OldSpriteAxis_ = 0;
+			uint8_t Change_ = 0;
+
+		public:
+			/**
+			* @brief O[vԍ擾
+			*
+			* @ύX̃O[vԍł(폜ꂽ摜͕ύXÕO[vԍ)
+			*
+			* @return int32_t GroupNo O[vԍ
+			*/
+			int32_t GroupNo() const noexcept { return Convert::DecodeSpriteGroupNo(SpriteNumber_); }
+
+			/**
+			* @brief C[Wԍ擾
+			*
+			* @ύX̃C[Wԍł(폜ꂽ摜͕ύXÕC[Wԍ)
+			*
+			* @return int32_t ImageNo C[Wԍ
+			*/
+			int32_t ImageNo() const noexcept { return Convert::DecodeSpriteImageNo(SpriteNumber_); }
+
+			/**
+			* @brief ύXÕO[vԍ擾
+			*
+			* @ԍύXꂽ摜ȊOGroupNoƓł
+			*
+			* @return int32_t OldGroupNo ύXÕO[vԍ
+			*/
+			int32_t OldGroupNo() const noexcept { return Convert::DecodeSpriteGroupNo(OldSpriteNumber_); }
+
+			/**
+			* @brief ύXÕC[Wԍ擾
+			*
+			* @ԍύXꂽ摜ȊOImageNoƓł
+			*
+			* @return int32_t OldImageNo ύXÕC[Wԍ
+			*/
+			int32_t OldImageNo() const noexcept { return Convert::DecodeSpriteImageNo(OldSpriteNumber_); }
+
+			/**
+			* @brief W擾
+			*
+			* @ύX̎Wł(폜ꂽ摜͕ύXO̎W)
+			*
+			* @return int32_t AxisX/AxisY W
+			*/
+			int32_t AxisX() const noexcept { return Convert::DecodeSpriteAxisX(SpriteAxis_); }
+			int32_t AxisY() const noexcept { return Convert::DecodeSpriteAxisY(SpriteAxis_); }
+
+			/**
+			* @brief ύXO̎W擾
+			*
+			* @ǉꂽ摜͕ύX̎Wł
+			*
+			* @return int32_t OldAxisX/OldAxisY ύXO̎W
+			*/
+			int32_t OldAxisX() const noexcept { return Convert::DecodeSpriteAxisX(OldSpriteAxis_); }
+			int32_t OldAxisY() const noexcept { return Convert::DecodeSpriteAxisY(OldSpriteAxis_); }
+
+			/**
+			* @brief ύXe擾
+			*
+			* @Moved(ԍ̕ύX)AxisChangedEPaletteChangedƓɗƂ܂
+			*
+			* @AxisChangedEPixelChangedEPaletteChanged͓ɕƂ܂
+			*
+			* @return bool 茋 (false = YȂFtrue = Y)
+			*/
+			bool IsAdded() const noexcept { return Change_ & kAdded; }
+			bool IsRemoved() const noexcept { return Change_ & kRemoved; }
+			bool IsMoved() const noexcept { return Change_ & kMoved; }
+			bool AxisChanged() const noexcept { return Change_ & kAxisChanged; }
+			bool PixelChanged() const noexcept { return Change_ & kPixelChanged; }
+			bool PaletteChanged() const noexcept { return Change_ & kPaletteChanged; }
+
+		public:
+			T_SFFDiffEntry(int32_t SpriteNumber, int32_t OldSpriteNumber, int32_t SpriteAxis, int32_t OldSpriteAxis, uint8_t Change) noexcept
+				: SpriteNumber_(SpriteNumber), OldSpriteNumber_(OldSpriteNumber), SpriteAxis_(SpriteAxis), OldSpriteAxis_(OldSpriteAxis), Change_(Change) {
+			}
+		};
+
+		// 2SFFt@C̉摜Pʂ̍
+		// Tuwb_[Ɖ摜f[^Epbgf[^̃nbVl݂̂rAf͍̕sȂ
+		struct T_SFFDiff {
+		private:
+			std::string OldFilePath_ = {};
+			std::string NewFilePath_ = {};
+			std::vector<T_SFFDiffEntry> EntryList_ = {};
+
+			// 摜f[^(nbVlƃoCg)𔻒
+			[[nodiscard]] static bool EqualPixel(const T_CatalogEntry& Left, const T_CatalogEntry& Right) noexcept {
+				return Left.Hash() == Right.Hash() && Left.DataSize() == Right.DataSize();
+			}
+
+			[[nodiscard]] static uint8_t CompareEntry(const T_CatalogEntry& OldEntry, uint64_t OldPaletteHash, const T_CatalogEntry& NewEntry, uint64_t NewPaletteHash) noexcept {
+				uint8_t Change = 0;
+				if (OldEntry.SpriteAxis() != NewEntry.SpriteAxis()) { Change |= T_SFFDiffEntry::kAxisChanged; }
+				if (!EqualPixel(OldEntry, NewEntry)) { Change |= T_SFFDiffEntry::kPixelChanged; }
+				if (OldPaletteHash != NewPaletteHash) { Change |= T_SFFDiffEntry::kPaletteChanged; }
+				return Change;
+			}
+
+		public:
+			/**
+			* @brief 2SFFt@Cr
+			*
+			* @̃t@C̃wb_[ƃTuwb_[ɑA摜ԍƂɕύXeW܂
+			*
+			* @摜f[^ƃpbgf[^̓oCg̃nbVlŔr邽߁AύX̂Ȃ摜͍̕s܂
+			*
+			* @ԍς̉摜(폜ꂽ摜Ɠ摜f[^ǉ摜)͒ǉƍ폜ł͂ȂMovedƂĕ񍐂܂
+			*
+			* @摜ԍ̏dƃN摜LoadSFFƓ߂܂
+			*
+			* @sꍇ͍ύX܂
+			*
+			* @param const std::string& OldFilePath ύXOSFFt@C̃pX
+			* @param const std::string& NewFilePath ύXSFFt@C̃pX
+			* @return bool r (false = sFtrue = )
+			*/
+			bool Compare(const std::string& OldFilePath, const std::string& NewFilePath) {
+				const std::filesystem::path FilePathList[2] = { OldFilePath, NewFilePath };
+				std::vector<T_CatalogEntry> EntryList[2] = {};
+				std::vector<uint64_t> PaletteHashList[2] = {};
+				int32_t ErrorID[2] = { -1, -1 };
+				T_ParallelFor::Run(2, [&](size_t index) {
+					std::error_code ErrorCode = {};
+					const uintmax_t FileSize = std::filesystem::file_size(FilePathList[index], ErrorCode);
+					if (ErrorCode) {
+						ErrorID[index] = ErrorMessage::OpenSFFFileFailed;
+						return;
+					}
+					T_ScanSFFFile ScanSFFFile(FilePathList[index], FileSize, true);
+					ErrorID[index] = ScanSFFFile.ErrorID();
+					EntryList[index] = std::move(ScanSFFFile.EntryList());
+					PaletteHashList[index] = ScanSFFFile.PaletteHashList();
+				});
+				for (const int32_t FileErrorID : ErrorID) {
+					if (FileErrorID >= 0) {
+						T_ErrorHandle::Instance().SetError(FileErrorID);
+						return false;
+					}
+				}
+				const std::vector<T_CatalogEntry>& OldEntryList = EntryList[0];
+				const std::vector<T_CatalogEntry>& NewEntryList = EntryList[1];
+
+				std::unordered_map<int32_t, size_t> OldNumberUMap = {};
+				OldNumberUMap.reserve(OldEntryList.size());
+				for (size_t index = 0; index < OldEntryList.size(); ++index) {
+					OldNumberUMap.emplace(OldEntryList[index].SpriteNumber(), index);
+				}
+
+				// ԍ̉摜r
+				std::vector<T_SFFDiffEntry> DiffList = {};
+				std::vector<bool> OldMatched(OldEntryList.size(), false);
+				std::vector<size_t> AddedList = {};
+				for (size_t index = 0; index < NewEntryList.size(); ++index) {
+					const T_CatalogEntry& NewEntry = NewEntryList[index];
+					const auto it = OldNumberUMap.find(NewEntry.SpriteNumber());
+					if (it == OldNumberUMap.end()) {
+						AddedList.push_back(index);
+						continue;
+					}
+					OldMatched[it->second] = true;
+					const T_CatalogEntry& OldEntry = OldEntryList[it->second];
+					if (const uint8_t Change = CompareEntry(OldEntry, PaletteHashList[0][it->second], NewEntry, PaletteHashList[1][index]); Change) {
+						DiffList.emplace_back(T_SFFDiffEntry(NewEntry.SpriteNumber(), OldEntry.SpriteNumber(), NewEntry.SpriteAxis(), OldEntry.SpriteAxis(), Change));
+					}
+				}
+
+				// 폜ꂽ摜Ɠ摜f[^ǉ摜͔ԍ̕ύXƂĈ
+				std::unordered_multimap<uint64_t, size_t> RemovedHashUMap = {};
+				for (size_t index = 0; index < OldEntryList.size(); ++index) {
+					if (!OldMatched[index] && OldEntryList[index].DataSize()) {
+						RemovedHashUMap.emplace(OldEntryList[index].Hash(), index);
+					}
+				}
+				for (const size_t index : AddedList) {
+					const T_CatalogEntry& NewEntry = NewEntryList[index];
+					size_t OldIndex = OldEntryList.size();
+					if (NewEntry.DataSize()) {
+						const auto Range = RemovedHashUMap.equal_range(NewEntry.Hash());
+						for (auto it = Range.first; it != Range.second; ++it) {
+							if (!OldMatched[it->second] && EqualPixel(OldEntryList[it->second], NewEntry) && it->second < OldIndex) {
+								OldIndex = it->second;
+							}
+						}
+					}
+					if (OldIndex < OldEntryList.size()) {
+						OldMatched[OldIndex] = true;
+						const T_CatalogEntry& OldEntry = OldEntryList[OldIndex];
+						const uint8_t Change = T_SFFDiffEntry::kMoved | CompareEntry(OldEntry, PaletteHashList[0][OldIndex], NewEntry, PaletteHashList[1][index]);
+						DiffList.emplace_back(T_SFFDiffEntry(NewEntry.SpriteNumber(), OldEntry.SpriteNumber(), NewEntry.SpriteAxis(), OldEntry.SpriteAxis(), Change));
+					}
+					else {
+						DiffList.emplace_back(T_SFFDiffEntry(NewEntry.SpriteNumber(), NewEntry.SpriteNumber(), NewEntry.SpriteAxis(), NewEntry.SpriteAxis(), T_SFFDiffEntry::kAdded));
+					}
+				}
+				for (size_t index = 0; index < OldEntryList.size(); ++index) {
+					if (OldMatched[index]) { continue; }
+					const T_CatalogEntry& OldEntry = OldEntryList[index];
+					DiffList.emplace_back(T_SFFDiffEntry(OldEntry.SpriteNumber(), OldEntry.SpriteNumber(), OldEntry.SpriteAxis(), OldEntry.SpriteAxis(), T_SFFDiffEntry::kRemoved));
+				}
+
+				OldFilePath_ = OldFilePath;
+				NewFilePath_ = NewFilePath;
+				EntryList_ = std::move(DiffList);
+				return true;
+			}
+
+			/**
+			* @brief eLXgt@C֏o
+			*
+			* @1s1摜AύXeƉ摜ԍo͂܂
+			*
+			* @ԍύXꂽ摜 "Moved ύXO -> ύX"Ȃ̕ύX "Changed ԍ axis pixel palette" ̌`ł
+			*
+			* @param const std::string& FilePath o͐̃t@CpX
+			* @return bool o͌ (false = sFtrue = )
+			*/
+			bool WriteReport(const std::string& FilePath) const {
+				std::ofstream File(FilePath);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSFFDiffFileFailed);
+					return false;
+				}
+				File << "Old " << OldFilePath_ << "\n";
+				File << "New " << NewFilePath_ << "\n";
+				for (const auto& Entry : EntryList_) {
+					if (Entry.IsAdded()) {
+						File << "Added " << Entry.GroupNo() << "," << Entry.ImageNo();
+					}
+					else if (Entry.IsRemoved()) {
+						File << "Removed " << Entry.GroupNo() << "," << Entry.ImageNo();
+					}
+					else if (Entry.IsMoved()) {
+						File << "Moved " << Entry.OldGroupNo() << "," << Entry.OldImageNo() << " -> " << Entry.GroupNo() << "," << Entry.ImageNo();
+					}
+					else {
+						File << "Changed " << Entry.GroupNo() << "," << Entry.ImageNo();
+					}
+					if (Entry.AxisChanged()) { File << " axis " << Entry.OldAxisX() << "," << Entry.OldAxisY() << " -> " << Entry.AxisX() << "," << Entry.AxisY(); }
+					if (Entry.PixelChanged()) { File << " pixel"; }
+					if (Entry.PaletteChanged()) { File << " palette"; }
+					File << "\n";
+				}
+				return File.good();
+			}
+
+			/**
+			* @brief ύX̂摜擾
+			*
+			* @return size_t NumEntry ύX̂摜
+			*/
+			size_t NumEntry() const noexcept { return EntryList_.size(); }
+
+			/**
+			* @brief ύXe擾
+			*
+			* @ԍ̉摜̕ύXAǉƔԍύXA폜̏ɕт܂(폜͕ύXOAȊO͕ύX̃t@C̕я)
+			*
+			* @param size_t EntryIndex ύX̃CfbNX (0 ` NumEntry - 1)
+			* @return const SFFDiff::Entry& Entry ύXe
+			*/
+			const T_SFFDiffEntry& GetEntry(size_t EntryIndex) const noexcept { return EntryList_[EntryIndex]; }
+
+			/**
+			* @brief rt@C̃pX擾
+			*
+			* @return const std::string& FilePath t@CpX
+			*/
+			const std::string& OldFilePath() const noexcept { return OldFilePath_; }
+			const std::string& NewFilePath() const noexcept { return NewFilePath_; }
+
+			/**
+			* @brief ̏
+			*/
+			void clear() {
+				OldFilePath_.clear();
+				NewFilePath_.clear();
+				EntryList_.clear();
+			}
+
+			/**
+			* @brief ̑݊mF
+			*
+			* @r2̃t@CɕύXȂꍇ true Ԃ܂
+			*
+			* @return bool 茋 (false = ύXFtrue = ύXȂ)
+			*/
+			bool empty() const noexcept { return EntryList_.empty(); }
+
+		public:
+			using Entry = T_SFFDiffEntry;
+
+			T_SFFDiff() = default;
+
+			T_SFFDiff(const std::string& OldFilePath, const std::string& NewFilePath) {
+				Compare(OldFilePath, NewFilePath);
+			}
+		};
+
+		// 8bitBMP/PCXpbgԍ̉fSFFv1t@C\z
+		// ǉ摜͕ۑɂ܂Ƃ߂ĕRLEkAf̓N摜Apbg͋LpbgƂďo͂
+		struct T_SFFBuilder {
+		private:
+			inline static constexpr ksize_t kBMPFileHeaderSize = 14;
+			inline static constexpr ksize_t kBMPInfoHeaderSize = 40;
+			inline static constexpr ksize_t kPCXPaletteSize = 1 + SFFFormat::kSFFPaletteSize; // ʒl0x0C + pbg
+
+			// ǉꂽ摜(f͏[1sWidthoCgŊi[)
+			struct T_SourceImage {
+				int32_t GroupNo = 0;
+				int32_t ImageNo = 0;
+				int32_t AxisX = 0;
+				int32_t AxisY = 0;
+				uint16_t Width = 0;
+				uint16_t Height = 0;
+				uint16_t HDPI = T_EncodePCX::kDefaultDPI; // 𑜓x(BMP/PCXǉꍇ͌̒lp)
+				uint16_t VDPI = T_EncodePCX::kDefaultDPI;
+				std::vector<unsigned char> Pixel = {};
+				std::array<unsigned char, SFFFormat::kSFFPaletteSize> Palette = {};
+			};
+
+			std::vector<T_SourceImage> ImageList_ = {};
+			std::unordered_map<int32_t, size_t> NumberUMap_ = {};
+
+			[[nodiscard]] static bool EqualPixel(const T_SourceImage& Left, const T_SourceImage& Right) noexcept {
+				return Left.Width == Right.Width && Left.Height == Right.Height && Left.HDPI == Right.HDPI && Left.VDPI == Right.VDPI && Left.Pixel == Right.Pixel;
+			}
+
+			[[nodiscard]] bool CheckImage(int32_t GroupNo, int32_t ImageNo, int32_t AxisX, int32_t AxisY, int32_t Width, int32_t Height) const {
+				if (GroupNo < 0 || GroupNo > UINT16_MAX || ImageNo < 0 || ImageNo > UINT16_MAX
+					|| AxisX < INT16_MIN || AxisX > INT16_MAX || AxisY < INT16_MIN || AxisY > INT16_MAX
+					|| Width < 1 || Width > T_EncodePCX::kMaxSize || Height < 1 || Height > T_EncodePCX::kMaxSize) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidSpriteParameter);
+					return false;
+				}
+				if (NumberUMap_.count(Convert::EncodeIntHalf(GroupNo, ImageNo))) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::DuplicateSpriteNumber, GroupNo, ImageNo);
+					return false;
+				}
+				return true;
+			}
+
+			// BMP̉𑜓x(sNZ/m)PCX̉𑜓x(DPI)֕ϊ
+			[[nodiscard]] static uint16_t ConvertDPI(uint32_t PixelPerMeter) noexcept {
+				return static_cast<uint16_t>((std::min)(PixelPerMeter / 39.3701 + 0.5, static_cast<double>(UINT16_MAX)));
+			}
+
+			void AddSourceImage(T_SourceImage&& Image) {
+				NumberUMap_.emplace(Convert::EncodeIntHalf(Image.GroupNo, Image.ImageNo), ImageList_.size());
+				ImageList_.emplace_back(std::move(Image));
+			}
+
+			[[nodiscard]] static bool ReadFile(const std::string& FilePath, std::vector<unsigned char>& FileData) {
+				std::ifstream File(std::filesystem::path(FilePath), std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::OpenImageFileFailed);
+					return false;
+				}
+				FileData.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+				if (File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::OpenImageFileFailed);
+					return false;
+				}
+				return true;
+			}
+
+			// CheckImageŊmFς݂̉摜ǉ
+			void AddPixel(int32_t GroupNo, int32_t ImageNo, int32_t AxisX, int32_t AxisY, const unsigned char* const Pixel, int32_t Width, int32_t Height, const unsigned char* const PaletteBinary, size_t Pitch, uint16_t HDPI, uint16_t VDPI) {
+				T_SourceImage Image = { GroupNo, ImageNo, AxisX, AxisY, static_cast<uint16_t>(Width), static_cast<uint16_t>(Height), HDPI, VDPI };
+				Image.Pixel.resize(static_cast<size_t>(Width) * Height);
+				for (int32_t y = 0; y < Height; ++y) {
+					std::memcpy(Image.Pixel.data() + static_cast<size_t>(y) * Width, Pixel + static_cast<size_t>(y) * Pitch, static_cast<size_t>(Width));
+				}
+				std::memcpy(Image.Palette.data(), PaletteBinary, SFFFormat::kSFFPaletteSize);
+				AddSourceImage(std::move(Image));
+			}
+
+			// t@C(gq) "O[vԍ_C[Wԍ" ܂ "O[vԍ_C[Wԍ_WX_WY" 
+			[[nodiscard]] static bool ParseFileName(const std::string& Stem, int32_t (&Field)[4]) noexcept {
+				Field[2] = Field[3] = 0;
+				size_t NumField = 0;
+				for (size_t Start = 0;; ++NumField) {
+					if (NumField == 4) { return false; } // ؂肪
+					const size_t End = (std::min)(Stem.find('_', Start), Stem.size());
+					const auto Result = std::from_chars(Stem.data() + Start, Stem.data() + End, Field[NumField]);
+					if (Result.ec != std::errc() || Result.ptr != Stem.data() + End) { return false; }
+					if (End == Stem.size()) { break; }
+					Start = End + 1;
+				}
+				++NumField;
+				return NumField == 2 || NumField == 4;
+			}
+
+			// f̉摜܂Ƃ߂Ăӂȉ摜݂̂RLEkASFFf[^̕\\z(߂l̓O[v)
+			int32_t BuildSFFBinaryData(T_SFFBinaryData& SFFBinaryData) const {
+				const size_t NumImage = ImageList_.size();
+				std::vector<uint64_t> PixelHash(NumImage);
+				T_ParallelFor::Run(NumImage, [&](size_t index) {
+					PixelHash[index] = HashBinary::FNV1a64(ImageList_[index].Pixel.data(), ImageList_[index].Pixel.size());
+				});
+
+				// 摜Ƃ̉摜f[^Epbgf[^̃CfbNX
+				std::vector<ksize_t> SpriteIndex(NumImage);
+				std::vector<ksize_t> PaletteIndex(NumImage);
+				std::vector<size_t> UniqueSprite = {};
+				std::vector<size_t> UniquePalette = {};
+				std::unordered_multimap<uint64_t, ksize_t> SpriteHashUMap = {};
+				std::unordered_multimap<uint64_t, ksize_t> PaletteHashUMap = {};
+				for (size_t index = 0; index < NumImage; ++index) {
+					const T_SourceImage& Image = ImageList_[index];
+					SpriteIndex[index] = static_cast<ksize_t>(UniqueSprite.size());
+					const auto SpriteRange = SpriteHashUMap.equal_range(PixelHash[index]);
+					for (auto it = SpriteRange.first; it != SpriteRange.second; ++it) {
+						if (EqualPixel(ImageList_[UniqueSprite[it->second]], Image)) {
+							SpriteIndex[index] = it->second;
+							break;
+						}
+					}
+					if (SpriteIndex[index] == UniqueSprite.size()) {
+						SpriteHashUMap.emplace(PixelHash[index], SpriteIndex[index]);
+						UniqueSprite.push_back(index);
+					}
+
+					const uint64_t PaletteHash = HashBinary::FNV1a64(Image.Palette.data(), Image.Palette.size());
+					PaletteIndex[index] = static_cast<ksize_t>(UniquePalette.size());
+					const auto PaletteRange = PaletteHashUMap.equal_range(PaletteHash);
+					for (auto it = PaletteRange.first; it != PaletteRange.second; ++it) {
+						if (ImageList_[UniquePalette[it->second]].Palette == Image.Palette) {
+							PaletteIndex[index] = it->second;
+							break;
+						}
+					}
+					if (PaletteIndex[index] == UniquePalette.size()) {
+						PaletteHashUMap.emplace(PaletteHash, PaletteIndex[index]);
+						UniquePalette.push_back(index);
+					}
+				}
+
+				// RLEk͉摜ƂɓƗĂ邽߁Aӂȉ摜ɏ
+				std::vector<std::vector<unsigned char>> SpriteList(UniqueSprite.size());
+				std::vector<T_OpaqueRect> OpaqueRectList(UniqueSprite.size());
+				T_ParallelFor::Run(UniqueSprite.size(), [&](size_t index) {
+					const T_SourceImage& Image = ImageList_[UniqueSprite[index]];
+					SpriteList[index] = T_EncodePCX::Encode(Image.Pixel.data(), Image.Width, Image.Height, Image.Width, Image.HDPI, Image.VDPI);
+					OpaqueRectList[index] = T_VerifySpriteBinary(SpriteList[index].data(), static_cast<ksize_t>(SpriteList[index].size())).OpaqueRect();
+				});
+
+				SFFBinaryData.reserve(static_cast<ksize_t>(NumImage), static_cast<ksize_t>(UniquePalette.size() * SFFFormat::kSFFPaletteSize));
+				for (size_t index = 0; index < SpriteList.size(); ++index) {
+					SFFBinaryData.AddSprite(SpriteList[index], true, OpaqueRectList[index]);
+					std::vector<unsigned char>().swap(SpriteList[index]);
+				}
+				for (const size_t index : UniquePalette) {
+					SFFBinaryData.AddPalette(ImageList_[index].Palette);
+				}
+
+				// 摜ƃpbg̑gݍ킹ƂɃCfbNXXg֓o^
+				std::unordered_map<uint64_t, ksize_t> IndexListUMap = {};
+				std::vector<int32_t> GroupList = {};
+				GroupList.reserve(NumImage);
+				for (size_t index = 0; index < NumImage; ++index) {
+					const T_SourceImage& Image = ImageList_[index];
+					const uint64_t Key = (static_cast<uint64_t>(SpriteIndex[index]) << 32) | PaletteIndex[index];
+					const auto Result = IndexListUMap.emplace(Key, static_cast<ksize_t>(SFFBinaryData.IndexList().size()));
+					if (Result.second) {
+						SFFBinaryData.AddIndexList(SpriteIndex[index], PaletteIndex[index]);
+					}
+					SFFBinaryData.AddDataList(Result.first->second, Image.AxisX, Image.AxisY, Image.GroupNo, Image.ImageNo);
+					GroupList.push_back(Image.GroupNo);
+				}
+				std::sort(GroupList.begin(), GroupList.end());
+				return static_cast<int32_t>(std::unique(GroupList.begin(), GroupList.end()) - GroupList.begin());
+			}
+
+		public:
+			/**
+			* @brief pbgԍ̉fǉ
+			*
+			* @8bit̃pbgԍ̉fƃpbg1̉摜ƂĒǉ܂
+			*
+			* @f̓Rs[ĕێ邽߁AĂяoɉł܂
+			*
+			* @摜ԍǉς݂̏ꍇAԍEWETCYSFFv1`͈̔͊Ȍꍇ͒ǉ܂
+			*
+			* @param int32_t GroupNo O[vԍ (0 ` 65535)
+			* @param int32_t ImageNo C[Wԍ (0 ` 65535)
+			* @param int32_t AxisX WX (-32768 ` 32767)
+			* @param int32_t AxisY WY (-32768 ` 32767)
+			* @param const unsigned char* Pixel [̍s񂾃pbgԍ̉f
+			* @param int32_t Width  (1 ` 65534)
+			* @param int32_t Height c (1 ` 65534)
+			* @param const unsigned char* PaletteBinary pbgf[^ (RGB256F768Byte)
+			* @param size_t Pitch f1s̃oCg (0 = Width)
+			* @return bool ǉ (false = sFtrue = )
+			*/
+			bool AddImage(int32_t GroupNo, int32_t ImageNo, int32_t AxisX, int32_t AxisY, const unsigned char* const Pixel, int32_t Width, int32_t Height, const unsigned char* const PaletteBinary, size_t Pitch = 0) {
+				if (!Pixel || !PaletteBinary) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidSpriteParameter);
+					return false;
+				}
+				if (!CheckImage(GroupNo, ImageNo, AxisX, AxisY, Width, Height)) { return false; }
+				AddPixel(GroupNo, ImageNo, AxisX, AxisY, Pixel, Width, Height, PaletteBinary, (Pitch ? Pitch : static_cast<size_t>(Width)), T_EncodePCX::kDefaultDPI, T_EncodePCX::kDefaultDPI);
+				return true;
+			}
+
+			/**
+			* @brief BMPf[^ǉ
+			*
+			* @k8bitBMP({gAbvEgbv_E̗)1̉摜ƂĒǉ܂
+			*
+			* @BMP̃pbg256FɖȂꍇAc͍(0,0,0)ɂȂ܂
+			*
+			* @param int32_t GroupNo O[vԍ (0 ` 65535)
+			* @param int32_t ImageNo C[Wԍ (0 ` 65535)
+			* @param int32_t AxisX WX (-32768 ` 32767)
+			* @param int32_t AxisY WY (-32768 ` 32767)
+			* @param const std::vector<unsigned char>& BMPBinaryData BMPf[^
+			* @return bool ǉ (false = sFtrue = )
+			*/
+			bool AddBMP(int32_t GroupNo, int32_t ImageNo, int32_t AxisX, int32_t AxisY, const std::vector<unsigned char>& BMPBinaryData) {
+				const unsigned char* const Ptr = BMPBinaryData.data();
+				const size_t Size = BMPBinaryData.size();
+				if (Size < kBMPFileHeaderSize + kBMPInfoHeaderSize || Ptr[0] != 'B' || Ptr[1] != 'M') {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidImageFile);
+					return false;
+				}
+				const size_t PixelOffBits = DecodeBinary::UInt32LE(&Ptr[10]);
+				const size_t InfoHeaderSize = DecodeBinary::UInt32LE(&Ptr[14]);
+				const int32_t Width = static_cast<int32_t>(DecodeBinary::UInt32LE(&Ptr[18]));
+				const int32_t SignedHeight = static_cast<int32_t>(DecodeBinary::UInt32LE(&Ptr[22]));
+				const uint16_t BitsPerPixel = DecodeBinary::UInt16LE(&Ptr[28]);
+				const uint32_t Compression = DecodeBinary::UInt32LE(&Ptr[30]);
+				const size_t NumColor = (DecodeBinary::UInt32LE(&Ptr[46]) ? DecodeBinary::UInt32LE(&Ptr[46]) : 256);
+				if (InfoHeaderSize < kBMPInfoHeaderSize || BitsPerPixel != 8 || Compression != 0 || NumColor > 256 || SignedHeight == INT32_MIN) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidImageFile);
+					return false;
+				}
+				const int32_t Height = (SignedHeight < 0 ? -SignedHeight : SignedHeight); // ̒l̓gbv_E
+				if (!CheckImage(GroupNo, ImageNo, AxisX, AxisY, Width, Height)) { return false; }
+				const size_t Stride = (static_cast<size_t>(Width) + 3) & ~static_cast<size_t>(3);
+				const size_t PaletteStart = kBMPFileHeaderSize + InfoHeaderSize;
+				if (PaletteStart + NumColor * 4 > Size || PixelOffBits > Size || Stride * Height > Size - PixelOffBits) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidImageFile);
+					return false;
+				}
+
+				T_SourceImage Image = { GroupNo, ImageNo, AxisX, AxisY, static_cast<uint16_t>(Width), static_cast<uint16_t>(Height)
+					, ConvertDPI(DecodeBinary::UInt32LE(&Ptr[38])), ConvertDPI(DecodeBinary::UInt32LE(&Ptr[42])) };
+				for (size_t i = 0; i < NumColor; ++i) {
+					Image.Palette[i * 3 + 0] = Ptr[PaletteStart + i * 4 + 2]; // R
+					Image.Palette[i * 3 + 1] = Ptr[PaletteStart + i * 4 + 1]; // G
+					Image.Palette[i * 3 + 2] = Ptr[PaletteStart + i * 4 + 0]; // B
+				}
+				Image.Pixel.resize(static_cast<size_t>(Width) * Height);
+				for (int32_t y = 0; y < Height; ++y) {
+					const int32_t SourceY = (SignedHeight > 0 ? Height - 1 - y : y);
+					std::memcpy(Image.Pixel.data() + static_cast<size_t>(y) * Width, Ptr + PixelOffBits + static_cast<size_t>(SourceY) * Stride, static_cast<size_t>(Width));
+				}
+				AddSourceImage(std::move(Image));
+				return true;
+			}
+
+			/**
+			* @brief BMPt@Cǉ
+			*
+			* @param int32_t GroupNo O[vԍ (0 ` 65535)
+			* @param int32_t ImageNo C[Wԍ (0 ` 65535)
+			* @param int32_t AxisX WX (-32768 ` 32767)
+			* @param int32_t AxisY WY (-32768 ` 32767)
+			* @param const std::string& FilePath 8bitBMPt@C̃pX
+			* @return bool ǉ (false = sFtrue = )
+			*/
+			bool AddBMP(int32_t GroupNo, int32_t ImageNo, int32_t AxisX, int32_t AxisY, const std::string& FilePath) {
+				std::vector<unsigned char> BMPBinaryData = {};
+				if (!ReadFile(FilePath, BMPBinaryData)) { return false; }
+				return AddBMP(GroupNo, ImageNo, AxisX, AxisY, BMPBinaryData);
+			}
+
+			/**
+			* @brief PCXf[^ǉ
+			*
+			* @256Fpbg8bitPCX(1v[ARLEk)1̉摜ƂĒǉ܂
+			*
+			* @f͈xĂۑɈk߁ARLE̋؂͈p܂
+			*
+			* @param int32_t GroupNo O[vԍ (0 ` 65535)
+			* @param int32_t ImageNo C[Wԍ (0 ` 65535)
+			* @param int32_t AxisX WX (-32768 ` 32767)
+			* @param int32_t AxisY WY (-32768 ` 32767)
+			* @param const std::vector<unsigned char>& PCXBinaryData PCXf[^
+			* @return bool ǉ (false = sFtrue = )
+			*/
+			bool AddPCX(int32_t GroupNo, int32_t ImageNo, int32_t AxisX, int32_t AxisY, const std::vector<unsigned char>& PCXBinaryData) {
+				const unsigned char* const Ptr = PCXBinaryData.data();
+				const size_t Size = PCXBinaryData.size();
+				if (Size <= SFFFormat::kSpriteBinaryPixelOffbits + kPCXPaletteSize || Ptr[0] != 0x0A || Ptr[2] != 0x01 || Ptr[65] != 0x01 || Ptr[Size - kPCXPaletteSize] != 0x0C) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidImageFile);
+					return false;
+				}
+				// SFF̉摜f[^Ɠpbgʒl܂łfƂČ
+				const ksize_t SpriteBinarySize = static_cast<ksize_t>(Size - SFFFormat::kSFFPaletteSize);
+				if (!T_VerifySpriteBinary(Ptr, SpriteBinarySize).Verified()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidImageFile);
+					return false;
+				}
+				const int32_t Width = static_cast<uint16_t>(1 + DecodeBinary::UInt16LE(&Ptr[8]));
+				const int32_t Height = static_cast<uint16_t>(1 + DecodeBinary::UInt16LE(&Ptr[10]));
+				const size_t BytesPerLine = DecodeBinary::UInt16LE(&Ptr[66]);
+				if (!CheckImage(GroupNo, ImageNo, AxisX, AxisY, Width, Height)) { return false; }
+
+				std::vector<unsigned char> Decide(T_BuildBMPBinary::DecodedSize(Ptr));
+				T_BuildBMPBinary::DecodeVerifiedSprite(Ptr, Decide.data(), Decide.size());
+				AddPixel(GroupNo, ImageNo, AxisX, AxisY, Decide.data(), Width, Height, Ptr + Size - SFFFormat::kSFFPaletteSize, BytesPerLine, DecodeBinary::UInt16LE(&Ptr[12]), DecodeBinary::UInt16LE(&Ptr[14]));
+				return true;
+			}
+
+			/**
+			* @brief PCXt@Cǉ
+			*
+			* @param int32_t GroupNo O[vԍ (0 ` 65535)
+			* @param int32_t ImageNo C[Wԍ (0 ` 65535)
+			* @param int32_t AxisX WX (-32768 ` 32767)
+			* @param int32_t AxisY WY (-32768 ` 32767)
+			* @param const std::string& FilePath 8bitPCXt@C̃pX
+			* @return bool ǉ (false = sFtrue = )
+			*/
+			bool AddPCX(int32_t GroupNo, int32_t ImageNo, int32_t AxisX, int32_t AxisY, const std::string& FilePath) {
+				std::vector<unsigned char> PCXBinaryData = {};
+				if (!ReadFile(FilePath, PCXBinaryData)) { return false; }
+				return AddPCX(GroupNo, ImageNo, AxisX, AxisY, PCXBinaryData);
+			}
+
+			/**
+			* @brief tH_BMP/PCXt@Cǉ
+			*
+			* @t@C(gq) "O[vԍ_C[Wԍ" ܂ "O[vԍ_C[Wԍ_WX_WY" ̃t@C摜ԍɒǉ܂
+			*
+			* @Wȗꍇ(0,0)ɂȂ܂
+			*
+			* @t@C`ɍȂt@CƃTutH_͖AǉɎst@C̓G[L^ēǂݔ΂܂
+			*
+			* @param const std::string& FolderPath Ώۂ̃tH_pX
+			* @return int32_t NumAdded ǉ摜
+			*/
+			int32_t AddFolder(const std::string& FolderPath) {
+				struct T_FolderImage {
+					int32_t Field[4];
+					std::filesystem::path Path;
+					bool PCX;
+				};
+				std::vector<T_FolderImage> FolderImageList = {};
+				std::error_code ErrorCode = {};
+				for (const auto& entry : std::filesystem::directory_iterator(FolderPath, std::filesystem::directory_options::skip_permission_denied, ErrorCode)) {
+					if (!entry.is_regular_file()) { continue; }
+					std::string Extension = entry.path().extension().string();
+					std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](char c) { return (c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c); });
+					if (Extension != ".bmp" && Extension != ".pcx") { continue; }
+					T_FolderImage FolderImage = { {}, entry.path(), Extension == ".pcx" };
+					if (!ParseFileName(entry.path().stem().string(), FolderImage.Field)) { continue; }
+					FolderImageList.emplace_back(std::move(FolderImage));
+				}
+				std::sort(FolderImageList.begin(), FolderImageList.end(), [](const T_FolderImage& Left, const T_FolderImage& Right) {
+					return Left.Field[0] != Right.Field[0] ? Left.Field[0] < Right.Field[0] : Left.Field[1] < Right.Field[1];
+				});
+
+				int32_t NumAdded = 0;
+				for (const auto& FolderImage : FolderImageList) {
+					const int32_t* const Field = FolderImage.Field;
+					const std::string FilePath = FolderImage.Path.string();
+					if (FolderImage.PCX ? AddPCX(Field[0], Field[1], Field[2], Field[3], FilePath) : AddBMP(Field[0], Field[1], Field[2], Field[3], FilePath)) {
+						++NumAdded;
+					}
+				}
+				return NumAdded;
+			}
+
+			/**
+			* @brief SFFt@CƂĕۑ
+			*
+			* @ǉ摜SFFv1`̃t@CƂĕۑ܂
+			*
+			* @摜RLEk͉摜PʂŕɍsAf̉摜1xk܂
+			*
+			* @摜ƃpbg̑gݍ킹̓N摜AỎ摜Ɠpbg͋LpbgƂďo͂܂
+			*
+			* @k摜f[^̓ɕێ܂At@C͐擪1xɏނ߁At@CŜ̓̕ɍ\z܂
+			*
+			* @t@CTCYSFFv1̏(4GiB)𒴂ꍇ͎s܂
+			*
+			* @摜1ǉĂȂꍇNoSpriteToSaveƂĎs܂
+			*
+			* @ꎞt@C֏񂾌ɒu邽߁AsɊ̃t@C͕ύX܂
+			*
+			* @param const std::string& FilePath ۑ̃t@CpX
+			* @return bool ۑ (false = sFtrue = )
+			*/
+			bool Save(const std::string& FilePath) const {
+				if (ImageList_.empty()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::NoSpriteToSave);
+					return false;
+				}
+				T_SFFBinaryData SFFBinaryData;
+				const int32_t NumGroup = BuildSFFBinaryData(SFFBinaryData);
+				const unsigned char SharedPal = (SFFBinaryData.NumPalette() == 1 ? 1 : 0); // S摜1̃pbggꍇ̂݋Lpbg`
+				const std::filesystem::path SavePath = FilePath;
+				std::filesystem::path TempPath = SavePath;
+				TempPath += ".tmp";
+
+				std::ofstream File(TempPath, std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSFFFileFailed);
+					return false;
+				}
+
+				const bool Written = T_BuildSFFBinary::Write(SFFBinaryData, NumGroup, SharedPal, [&File](const unsigned char* const Data, size_t Size) {
+					File.write(reinterpret_cast<const char*>(Data), Size);
+				});
+				if (!Written) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::SFFFileSizeOver);
+				}
+				File.flush();
+
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteSFFFileFailed);
+				}
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CloseSFFFileFailed);
+				}
+
+				std::error_code ErrorCode = {};
+				if (Written && File.good()) {
+					std::filesystem::rename(TempPath, SavePath, ErrorCode);
+					if (!ErrorCode) { return true; }
+					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteSFFFileFailed);
+				}
+				std::filesystem::remove(TempPath, ErrorCode);
+				return false;
+			}
+
+			/**
+			* @brief ǉ摜擾
+			*
+			* @return size_t NumImage 摜
+			*/
+			size_t NumImage() const noexcept { return ImageList_.size(); }
+
+			/**
+			* @brief ǉ摜̏
+			*/
+			void clear() {
+				ImageList_.clear();
+				NumberUMap_.clear();
+			}
+
+			/**
+			* @brief ǉ摜̑݊mF
+			*
+			* @return bool 茋 (false = ݂Ftrue = ݂Ȃ)
+			*/
+			bool empty() const noexcept { return ImageList_.empty(); }
+
+		public:
+			T_SFFBuilder() = default;
+		};
+
+		// ǂݍ݂̐i(񓯊ǂݍݎ͕ʃXbhQƂ)
+		struct T_LoadProgress {
+		private:
+			std::atomic<int32_t> NumImage_ = 0;
+			std::atomic<int32_t> NumLoadedImage_ = 0;
+			std::atomic<uint64_t> ReadByteSize_ = 0;
+			std::atomic<bool> Cancel_ = false;
+
+		public:
+			[[nodiscard]] int32_t NumImage() const noexcept { return NumImage_.load(std::memory_order_relaxed); }
+			[[nodiscard]] int32_t NumLoadedImage() const noexcept { return NumLoadedImage_.load(std::memory_order_relaxed); }
+			[[nodiscard]] uint64_t ReadByteSize() const noexcept { return ReadByteSize_.load(std::memory_order_relaxed); }
+			[[nodiscard]] bool Canceled() const noexcept { return Cancel_.load(std::memory_order_relaxed); }
+
+			void NumImage(int32_t value) noexcept { NumImage_.store(value, std::memory_order_relaxed); }
+			void Update(int32_t NumLoadedImage, uint64_t ReadByteSize) noexcept {
+				NumLoadedImage_.store(NumLoadedImage, std::memory_order_relaxed);
+				ReadByteSize_.store(ReadByteSize, std::memory_order_relaxed);
+			}
+			void Cancel() noexcept { Cancel_.store(true, std::memory_order_relaxed); }
+		};
+
+		// 񓯊ǂݍ݂̋L
+		struct T_AsyncLoadState {
+		private:
+			T_LoadProgress Progress_ = {};
+			const bool kStreaming;				// ǂݍݍς݂̉摜J邩
+			std::atomic<bool> Loading_ = true;	// ǂݍݐSFF֏ݒ
+			std::atomic<ksize_t> NumPublishedData_ = 0; // QƉ\ȃf[^Xg(Xg[~Oǂݍݎ̂)
+			bool Finished_ = false;				// R[obN܂ŏI
+			bool Result_ = false;
+			std::exception_ptr Exception_ = {};
+			mutable std::mutex Mutex = {};
+			mutable std::condition_variable ConditionVariable = {};
+
+		public:
+			[[nodiscard]] T_LoadProgress& Progress() noexcept { return Progress_; }
+			[[nodiscard]] const T_LoadProgress& Progress() const noexcept { return Progress_; }
+			[[nodiscard]] bool Loading() const noexcept { return Loading_.load(std::memory_order_acquire); }
+			[[nodiscard]] bool Streaming() const noexcept { return kStreaming; }
+			[[nodiscard]] ksize_t NumPublishedData() const noexcept { return NumPublishedData_.load(std::memory_order_acquire); }
+
+			[[nodiscard]] bool Finished() const {
+				std::lock_guard<std::mutex> Lock(Mutex);
+				return Finished_;
+			}
+
+			// f[^Xg̏݌ɌĂяoA擪w萔܂łQƉ\ɂ
+			void Publish(ksize_t NumDataList) {
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					NumPublishedData_.store(NumDataList, std::memory_order_release);
+				}
+				ConditionVariable.notify_all();
+			}
+
+			void LoadEnd() {
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					Loading_.store(false, std::memory_order_release);
+				}
+				ConditionVariable.notify_all();
+			}
+
+			void Finish(bool Result, std::exception_ptr Exception) {
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					Result_ = Result;
+					Exception_ = Exception;
+					Finished_ = true;
+				}
+				ConditionVariable.notify_all();
+			}
+
+			void WaitLoadEnd() const {
+				std::unique_lock<std::mutex> Lock(Mutex);
+				ConditionVariable.wait(Lock, [this] { return !Loading_.load(std::memory_order_relaxed); });
+			}
+
+			// Jw萔𒴂邩݂I܂őҋ@
+			void WaitPublish(ksize_t NumDataList) const {
+				std::unique_lock<std::mutex> Lock(Mutex);
+				ConditionVariable.wait(Lock, [this, NumDataList] {
+					return NumPublishedData_.load(std::memory_order_relaxed) > NumDataList || !Loading_.load(std::memory_order_relaxed);
+				});
+			}
+
+			void WaitFinish() const {
+				std::unique_lock<std::mutex> Lock(Mutex);
+				ConditionVariable.wait(Lock, [this] { return Finished_; });
+			}
+
+			[[nodiscard]] bool Result() const {
+				WaitFinish();
+				std::lock_guard<std::mutex> Lock(Mutex);
+				if (Exception_) { std::rethrow_exception(Exception_); }
+				return Result_;
+			}
+
+		public:
+			T_AsyncLoadState(bool Streaming) : kStreaming(Streaming) {}
+		};
+
+		// [U[̔񓯊ǂݍ݃nh
+		struct T_LoadSFFHandle {
+		private:
+			std::shared_ptr<T_AsyncLoadState> State_ = {};
+
+		public:
+			/**
+			* @brief nh̗LmF
+			*
+			* @񓯊ǂݍ݂ɑΉnhmF܂
+			*
+			* @return bool 茋 (false = Ftrue = L)
+			*/
+			bool valid() const noexcept { return static_cast<bool>(State_); }
+
+			/**
+			* @brief ǂݍ݊̊mF
+			*
+			* @ǂݍ݂ƊR[obN̎sImF܂
+			*
+			* @return bool 茋 (false = ǂݍݒFtrue = I)
+			*/
+			bool IsReady() const { return valid() && State_->Finished(); }
+
+			/**
+			* @brief ǂݍݑΏۂ̉摜擾
+			*
+			* @SFFwb_[ɋL^Ă摜Ԃ܂(wb_[ǂݍݑO 0)
+			*
+			* @return int32_t NumImage 摜
+			*/
+			int32_t NumImage() const noexcept { return (valid() ? State_->Progress().NumImage() : 0); }
+
+			/**
+			* @brief ς݂̉摜擾
+			*
+			* @return int32_t NumLoadedImage ς݂̉摜
+			*/
+			int32_t NumLoadedImage() const noexcept { return (valid() ? State_->Progress().NumLoadedImage() : 0); }
+
+			/**
+			* @brief ǂݍݍς݂̃oCg擾
+			*
+			* @return uint64_t ReadByteSize ǂݍݍς݂̃oCg
+			*/
+			uint64_t ReadByteSize() const noexcept { return (valid() ? State_->Progress().ReadByteSize() : 0); }
+
+			/**
+			* @brief ǂݍ݂̒f
+			*
+			* @ǂݍ݂̒fv܂
+			*
+			* @fꂽꍇSFFf[^͋̂܂܂ŁAʂ false ɂȂ܂
+			*/
+			void Cancel() noexcept { if (valid()) { State_->Progress().Cancel(); } }
+
+			/**
+			* @brief ǂݍ݊܂őҋ@
+			*
+			* @R[obNĂяoȂł
+			*/
+			void Wait() const { if (valid()) { State_->WaitFinish(); } }
+
+			/**
+			* @brief ǂݍ݌ʂ̎擾
+			*
+			* @ǂݍ݊܂őҋ@ČʂԂ܂
+			*
+			* @ǂݍݒɗOĂꍇ̗͂O𓊂܂
+			*
+			* @return bool ǂݍ݌ (false = s܂͒fFtrue = )
+			*/
+			bool get() const { return (valid() ? State_->Result() : false); }
+
+		public:
+			T_LoadSFFHandle() = default;
+
+			T_LoadSFFHandle(const std::shared_ptr<T_AsyncLoadState>& State) : State_(State) {}
+		};
+
+		// ǂ݂̋L(iNumImage͑ΏېANumLoadedImage͏ςݐ)
+		struct T_PrefetchState : public T_AsyncLoadState {
+		private:
+			std::atomic<int32_t> NumAlreadyWarm_ = 0; // ǂ݊Jn_ŕς݂
+
+		public:
+			[[nodiscard]] int32_t NumAlreadyWarm() const noexcept { return NumAlreadyWarm_.load(std::memory_order_relaxed); }
+			void NumAlreadyWarm(int32_t value) noexcept { NumAlreadyWarm_.store(value, std::memory_order_relaxed); }
+
+		public:
+			T_PrefetchState() : T_AsyncLoadState(false) {}
+		};
+
+		// [U[̐ǂ݃nh
+		struct T_PrefetchHandle {
+		private:
+			std::shared_ptr<T_PrefetchState> State_ = {};
+
+		public:
+			/**
+			* @brief nh̗LmF
+			*
+			* @return bool 茋 (false = Ftrue = L)
+			*/
+			bool valid() const noexcept { return static_cast<bool>(State_); }
+
+			/**
+			* @brief ǂ݊̊mF
+			*
+			* @ǂ݂ƊR[obN̎sImF܂
+			*
+			* @return bool 茋 (false = ǂݒFtrue = I)
+			*/
+			bool IsReady() const { return valid() && State_->Finished(); }
+
+			/**
+			* @brief ǂݑΏۂ̉摜f[^擾
+			*
+			* @摜f[^L摜 1 ƂĐ܂(Ώۂ̊mO 0)
+			*
+			* @return int32_t NumTarget Ώې
+			*/
+			int32_t NumTarget() const noexcept { return (valid() ? State_->Progress().NumImage() : 0); }
+
+			/**
+			* @brief ς݂̉摜f[^擾
+			*
+			* @ǂ݊Jn_ŕς݂̂܂݂܂
+			*
+			* @return int32_t NumWarmed ς݂̐
+			*/
+			int32_t NumWarmed() const noexcept { return (valid() ? State_->Progress().NumLoadedImage() : 0); }
+
+			/**
+			* @brief ǂ݊Jn_ŕς݂摜f[^擾
+			*
+			* @return int32_t NumAlreadyWarm ς݂
+			*/
+			int32_t NumAlreadyWarm() const noexcept { return (valid() ? State_->NumAlreadyWarm() : 0); }
+
+			/**
+			* @brief ǂ݂̒f
+			*
+			* @ǂ݂̒fv܂Bf܂łɕ摜͐ǂݍς݂̂܂܎cAʂ false ɂȂ܂
+			*/
+			void Cancel() noexcept { if (valid()) { State_->Progress().Cancel(); } }
+
+			/**
+			* @brief ǂ݊܂őҋ@
+			*
+			* @R[obNĂяoȂł
+			*/
+			void Wait() const { if (valid()) { State_->WaitFinish(); } }
+
+			/**
+			* @brief ǂ݌ʂ̎擾
+			*
+			* @ǂ݊܂őҋ@ČʂԂ܂
+			*
+			* @ǂݒɗOĂꍇ̗͂O𓊂܂
+			*
+			* @return bool ǂ݌ (false = fFtrue = )
+			*/
+			bool get() const { return (valid() ? State_->Result() : false); }
+
+		public:
+			T_PrefetchHandle() = default;
+
+			T_PrefetchHandle(const std::shared_ptr<T_PrefetchState>& State) : State_(State) {}
+		};
+
+		// ǂݍSFFf[^{
+		// T_SFFDataSpriteData狤LAJ͕ύXȂ(Xg[~Oǂݍݒ̂݌Jς݂͈̔͂֒ǋL)
+		struct T_SFFSnapshot {
+			int32_t NumGroup = 0;
+			int32_t NumImage = 0;
+			unsigned char SharedPal = 0; // wb_[̃pbg`(ۑɈp)
+			std::string FileName = {};
+			std::filesystem::path LoadFilePath = {};			// ēǂݍݗp̓ǂݍ݌t@CpX
+			std::filesystem::file_time_type LastWriteTime = {}; // ǂݍݎ̃t@CXV
+			T_LoadFilter LoadFilter = {};						// ǂݍމ摜̑Iʏ(ēǂݍݎgp)
+			std::vector<int32_t> EvictedGroupList = {};			// 摜f[^O[vԍ()
+			T_UnorderedMap SpriteNumberUMap = {};
+			T_UnorderedMap SpriteDataUMap = {};
+			T_SFFBinaryData SFFBinaryData = {};
+
+			T_SFFSnapshot() = default;
+
+			// \Ɖ摜f[^Epbgf[^w肵\[Xm
+			explicit T_SFFSnapshot(std::pmr::memory_resource* const Resource)
+				: SpriteNumberUMap(Resource), SpriteDataUMap(Resource), SFFBinaryData(Resource) {
+			}
+
+			[[nodiscard]] bool empty() const noexcept {
+				return FileName.empty() && SFFBinaryData.empty() && SpriteNumberUMap.empty() && SpriteDataUMap.empty();
+			}
+
+			void ReserveSpriteData(T_LoadSFFHeader& LoadSFFHeader) {
+				const ksize_t kNumImage = LoadSFFHeader.NumImages();
+				const ksize_t kPaletteSize = kNumImage * SFFFormat::kSFFPaletteSize;
+
+				SpriteNumberUMap.reserve(kNumImage);
+				SpriteDataUMap.reserve(kNumImage);
+				SFFBinaryData.reserve(kNumImage, kPaletteSize);
+			}
+
+			void shrink_to_fit() {
+				SpriteNumberUMap.shrink_to_fit();
+				SpriteDataUMap.shrink_to_fit();
+				SFFBinaryData.shrink_to_fit();
+			}
+
+			// ̃XibvVbg֓ǂݍ
+			// AsyncLoadStatew肵ꍇ͐i񍐂AXg[~Oǂݍ݂Ȃ1ƂɃf[^J
+			// Xg[~Oǂݍݎ͌Jς݂̃f[^QƂ邽߃̍ĊmۂsȂ
+			// ReloadBaseDataw肵ꍇ͕ύX̂Ȃ摜rp
+			// LoadFilterݒ肳Ăꍇ͏ɍ摜ƁA̎QƐ̉摜f[^Epbgf[^݂̂ǂݍ
+			bool LoadSFFFile(const std::string& FileName_, const std::string& FilePath_, T_AsyncLoadState* AsyncLoadState = nullptr, T_ReloadBaseData* ReloadBaseData = nullptr) {
+				const bool Streaming = (AsyncLoadState && AsyncLoadState->Streaming());
+				const bool Filtered = !LoadFilter.empty();
+				// Iʓǂݍ݂̓Tuwb_[Ԃǂݔ΂߁Aǂݑŏn߂ēǂݍމ摜ꍇ̂ݍL
+				T_LoadSFFHeader LoadSFFHeader(FileName_, FilePath_, (Filtered ? T_BufferedFileReader::kSparseWindowSize : T_BufferedFileReader::kWindowSize));
+				if (LoadSFFHeader.CheckError()) { return false; }
+				std::error_code ErrorCode = {};
+				const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(LoadSFFHeader.FilePath(), ErrorCode);
+				T_LoadSFFSubHeader LoadSFFSubHeader(LoadSFFHeader, ReloadBaseData, &LoadFilter);
+				if (LoadSFFSubHeader.CheckError()) { return false; }
+
+				// Xg[~Oǂݍ݂͌Jς݃f[^̃AhXŒ肷邽߁AŊmۂvf𒴂ȂO
+				// 摜f[^{̂̓`NPʂŊmۂ邽ߊi[ɈړȂ
+				// Iʓǂݍ݂͊i[Ȃ߁AXg[~Oǂݍ݈ȊOł͎OmۂsȂ
+				if (!Filtered || Streaming) { ReserveSpriteData(LoadSFFHeader); }
+				if (AsyncLoadState) { AsyncLoadState->Progress().NumImage(LoadSFFHeader.NumImages()); }
+
+				for (int32_t LoadNo = 0; LoadNo < LoadSFFHeader.NumImages(); ++LoadNo) {
+					if (LoadSFFSubHeader.ReadSpriteBinary(LoadNo, SpriteNumberUMap, SpriteDataUMap, SFFBinaryData)) { break; };
+					if (AsyncLoadState) {
+						if (Streaming) { AsyncLoadState->Publish(static_cast<ksize_t>(SFFBinaryData.DataList().size())); }
+						AsyncLoadState->Progress().Update(LoadNo + 1, static_cast<uint64_t>(LoadSFFHeader.tellg()));
+						if (AsyncLoadState->Progress().Canceled()) { return false; } // Jς݂̃f[^͎Qƒ̉\̂Ŏc
+					}
+				}
+				NumGroup = (Filtered ? SFFBinaryData.CountGroup() : static_cast<int32_t>(LoadSFFHeader.NumGroups()));
+				NumImage = static_cast<int32_t>(SpriteNumberUMap.size());
+				SharedPal = LoadSFFHeader.SharedPal();
+				FileName = LoadSFFHeader.FileName();
+				LoadFilePath = LoadSFFHeader.FilePath();
+				LastWriteTime = WriteTime;
+
+				// SẴ[hI]Ɋmۂ
+				// \[Xw肵ꍇ͉\[Xł܂Ƃ߂čsÔ߁Ak̂߂̍Ċmۂ͍sȂ
+				if (!Streaming && SFFBinaryData.resource() == std::pmr::get_default_resource()) { shrink_to_fit(); }
+
+				// Oo
+				if (T_Config::Instance().CreateLogFile()) {
+					T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSffFileFormat::kSystemDirectoryName : ""));
+					if (SAELibFile.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::SAELibFolderInvalidPath);
+						return false;
+					}
+					if (T_Config::Instance().CreateSAELibFile()) {
+						SAELibFile.CreateDirectory(SAELibFile.Path());
+						if (SAELibFile.ErrorCode()) {
+							T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSAELibFolderFailed);
+							return false;
+						}
+					}
+
+					const std::string ErrorLogFileName = std::string(ReadSffFileFormat::kErrorLogFileName) + "_" + FileName_ + ".txt";
+					std::ofstream ErrorLogFile(SAELibFile.Path() / ErrorLogFileName);
+					if (!ErrorLogFile.is_open()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::CreateErrorLogFileFailed);
+					}
+					T_ErrorHandle::Instance().WriteErrorLog(ErrorLogFile);
+				}
+
+				return true;
+			}
+		};
+
+		// 摜f[^ƃpbgf[^̑gݍ킹(IndexList)Pʂ̎Q
+		// Qƌ̃f[^LȂ߁A擾͈̔(SFF::UniqueImages)jꂽ͎gpȂ
+		struct T_ImageView {
+		private:
+			const T_SFFBinaryData* kSFFBinaryData;
+			ksize_t kIndexListIndex;
+
+		public:
+			/**
+			* @brief gݍ킹̃CfbNX擾
+			*
+			* @return ksize_t ImageIndex gݍ킹̃CfbNX (0 ` UniqueImages().size() - 1)
+			*/
+			ksize_t ImageIndex() const noexcept { return kIndexListIndex; }
+
+			/**
+			* @brief sNZf[^/pbgf[^̎擾
+			*
+			* @SpriteData̓̊֐Ɠł
+			*/
+			const unsigned char* const PixelBinaryData() const noexcept { return kSFFBinaryData->IndexList_Sprite(kIndexListIndex); }
+			size_t PixelBinaryDataByteSize() const noexcept { return static_cast<size_t>(IsResident() ? kSFFBinaryData->IndexList_SpriteSize(kIndexListIndex) : 0); }
+			const unsigned char* const PaletteBinaryData() const noexcept { return kSFFBinaryData->IndexList_Palette(kIndexListIndex); }
+			int32_t PaletteNo() const noexcept { return static_cast<int32_t>(kSFFBinaryData->IndexList(kIndexListIndex).PaletteIndex()); }
+
+			/**
+			* @brief 摜̕/E،ʁEǂݍς݂擾
+			*
+			* @SpriteData̓̊֐Ɠł
+			*/
+			uint16_t PixelWidth() const noexcept { return (IsResident() ? 1 + DecodeBinary::UInt16LE(&PixelBinaryData()[8]) : 0); }
+			uint16_t PixelHeight() const noexcept { return (IsResident() ? 1 + DecodeBinary::UInt16LE(&PixelBinaryData()[10]) : 0); }
+			bool IsVerified() const noexcept { return kSFFBinaryData->IndexList_SpriteVerified(kIndexListIndex); }
+			bool IsWarm() const { return kSFFBinaryData->IndexList_SpriteDecoded(kIndexListIndex) != nullptr; }
+
+			/**
+			* @brief 摜f[^ǂݍ܂Ă邩擾
+			*
+			* @SpriteData̓̊֐Ɠł
+			*/
+			bool IsResident() const noexcept { return kSFFBinaryData->IndexList_SpriteResident(kIndexListIndex); }
+
+			/**
+			* @brief BMPf[^̎擾
+			*
+			* @摜BMP`ɕϊf[^Ԃ܂
+			*
+			* @param std::pmr::memory_resource* ScratchResource p̍Ɨ̈̊mې (ȗ͊̃\[X)
+			* @return std::vector<unsigned char> BuildBMPBinaryData BMPf[^
+			*/
+			std::vector<unsigned char> BuildBMPBinaryData(std::pmr::memory_resource* const ScratchResource = nullptr) const {
+				if (!IsResident()) { return {}; }
+				const std::shared_ptr<const T_DecodedSprite> Decoded = kSFFBinaryData->IndexList_SpriteDecoded(kIndexListIndex);
+				return T_BuildBMPBinary(PixelBinaryData(), PaletteBinaryData(), static_cast<ksize_t>(PixelBinaryDataByteSize()), IsVerified(), nullptr, (Decoded ? Decoded->data() : nullptr), ScratchResource).vecdata();
+			}
+
+			/**
+			* @brief 32bitJ[ɓWJsNZf[^̎擾
+			*
+			* @SpriteData::ExpandPixelDataƓłBPaletteBinaryȗꍇ͎g̃pbggp܂
+			*
+			* @param unsigned char* const Dest ݐ̃obt@
+			* @param size_t DestPitch ݐ1s̃oCg
+			* @param PixelFormat Format sNZ`
+			* @param const unsigned char* const PaletteBinary pbgf[^z (ȗ͎g̃pbg)
+			* @param std::pmr::memory_resource* ScratchResource p̍Ɨ̈̊mې (ȗ͊̃\[X)
+			* @return bool ݌ (false = sFtrue = )
+			*/
+			bool ExpandPixelData(unsigned char* const Dest, size_t DestPitch, T_PixelFormat Format, const unsigned char* const PaletteBinary = nullptr, std::pmr::memory_resource* const ScratchResource = nullptr) const {
+				if (!Dest || !IsResident() || DestPitch < static_cast<size_t>(PixelWidth()) * 4) { return false; }
+				const unsigned char* const Sprite = PixelBinaryData();
+				const uint16_t Width = PixelWidth();
+				const uint16_t Height = PixelHeight();
+				const uint16_t BytesPerLine = DecodeBinary::UInt16LE(&Sprite[66]);
+
+				T_ExpandPalette::T_Table Table;
+				T_ExpandPalette::BuildTable((PaletteBinary ? PaletteBinary : PaletteBinaryData()), Format, Table);
+
+				// ǂ݂ĂȂ΂̏ŕ
+				const std::shared_ptr<const T_DecodedSprite> Decoded = kSFFBinaryData->IndexList_SpriteDecoded(kIndexListIndex);
+				std::pmr::vector<unsigned char> DecodeBuffer(ScratchResource ? ScratchResource : std::pmr::get_default_resource());
+				const unsigned char* Pixel = (Decoded ? Decoded->data() : nullptr);
+				if (!Pixel) {
+					DecodeBuffer.resize(T_BuildBMPBinary::DecodedSize(Sprite));
+					if (IsVerified()) {
+						T_BuildBMPBinary::DecodeVerifiedSprite(Sprite, DecodeBuffer.data(), DecodeBuffer.size());
+					}
+					else {
+						T_BuildBMPBinary::DecodeSprite(Sprite, static_cast<ksize_t>(PixelBinaryDataByteSize()), DecodeBuffer.data(), Height);
+					}
+					Pixel = DecodeBuffer.data();
+				}
+
+				// j摜1s̉fɖȂꍇAc͓ɂ
+				const uint16_t ExpandWidth = (std::min)(Width, BytesPerLine);
+				for (uint16_t y = 0; y < Height; ++y) {
+					unsigned char* const DestLine = Dest + y * DestPitch;
+					T_ExpandPalette::Expand(Pixel + static_cast<size_t>(y) * BytesPerLine, ExpandWidth, Table, DestLine);
+					if (ExpandWidth < Width) {
+						std::memset(DestLine + ExpandWidth * 4, 0x00, static_cast<size_t>(Width - ExpandWidth) * 4);
+					}
+				}
+				return true;
+			}
+
+		public:
+			T_ImageView(const T_SFFBinaryData& SFFBinaryData, ksize_t IndexListIndex) noexcept : kSFFBinaryData(&SFFBinaryData), kIndexListIndex(IndexListIndex) {}
+		};
+
+		// XibvVbg̔zYŎQƂCe[^
+		// vf͎QƂ̂тT_Get::GetŐyʂȒlŁACe[^̂͊mۂQƃJEg̑sȂ
+		// QƂl̂C++17̋敪͓̓Ce[^ƂAC++20iterator_conceptŃ_ANZX
+		template<typename T_Get>
+		struct T_IndexIterator {
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using iterator_concept = std::random_access_iterator_tag;
+			using value_type = decltype(T_Get::Get(std::declval<const T_SFFBinaryData&>(), ksize_t{}));
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = value_type;
+
+		private:
+			const T_SFFBinaryData* Data_ = nullptr;
+			difference_type Index_ = 0;
+
+		public:
+			reference operator*() const { return T_Get::Get(*Data_, static_cast<ksize_t>(Index_)); }
+			reference operator[](difference_type n) const { return T_Get::Get(*Data_, static_cast<ksize_t>(Index_ + n)); }
+
+			T_IndexIterator& operator++() noexcept { ++Index_; return *this; }
+			T_IndexIterator& operator--() noexcept { --Index_; return *this; }
+			T_IndexIterator operator++(int) noexcept { T_IndexIterator Old = *this; ++Index_; return Old; }
+			T_IndexIterator operator--(int) noexcept { T_IndexIterator Old = *this; --Index_; return Old; }
+			T_IndexIterator& operator+=(difference_type n) noexcept { Index_ += n; return *this; }
+			T_IndexIterator& operator-=(difference_type n) noexcept { Index_ -= n; return *this; }
+
+			friend T_IndexIterator operator+(T_IndexIterator it, difference_type n) noexcept { return it += n; }
+			friend T_IndexIterator operator+(difference_type n, T_IndexIterator it) noexcept { return it += n; }
+			friend T_IndexIterator operator-(T_IndexIterator it, difference_type n) noexcept { return it -= n; }
+			friend difference_type operator-(const T_IndexIterator& Left, const T_IndexIterator& Right) noexcept { return Left.Index_ - Right.Index_; }
+
+			friend bool operator==(const T_IndexIterator& Left, const T_IndexIterator& Right) noexcept { return Left.Index_ == Right.Index_; }
+			friend bool operator!=(const T_IndexIterator& Left, const T_IndexIterator& Right) noexcept { return Left.Index_ != Right.Index_; }
+			friend bool operator<(const T_IndexIterator& Left, const T_IndexIterator& Right) noexcept { return Left.Index_ < Right.Index_; }
+			friend bool operator>(const T_IndexIterator& Left, const T_IndexIterator& Right) noexcept { return Left.Index_ > Right.Index_; }
+			friend bool operator<=(const T_IndexIterator& Left, const T_IndexIterator& Right) noexcept { return Left.Index_ <= Right.Index_; }
+			friend bool operator>=(const T_IndexIterator& Left, const T_IndexIterator& Right) noexcept { return Left.Index_ >= Right.Index_; }
+
+		public:
+			T_IndexIterator() = default;
+
+			T_IndexIterator(const T_SFFBinaryData* Data, difference_type Index) noexcept : Data_(Data), Index_(Index) {}
+		};
+
+		// 擾̃XibvVbgێ͈
+		// ͈͂j܂ŗvf̎QƐ͉Ȃ
+		template<typename T_Get>
+		struct T_SnapshotRange {
+		private:
+			std::shared_ptr<const T_SFFSnapshot> Data_ = {};
+			ksize_t Size_ = 0;
+
+		public:
+			using iterator = T_IndexIterator<T_Get>;
+			using const_iterator = iterator;
+			using value_type = typename iterator::value_type;
+			using size_type = size_t;
+			using difference_type = typename iterator::difference_type;
+
+			iterator begin() const noexcept { return iterator((Data_ ? &Data_->SFFBinaryData : nullptr), 0); }
+			iterator end() const noexcept { return iterator((Data_ ? &Data_->SFFBinaryData : nullptr), static_cast<difference_type>(Size_)); }
+			size_t size() const noexcept { return Size_; }
+			bool empty() const noexcept { return Size_ == 0; }
+			value_type operator[](size_t index) const { return begin()[static_cast<difference_type>(index)]; }
+
+		public:
+			T_SnapshotRange() = default;
+
+			T_SnapshotRange(std::shared_ptr<const T_SFFSnapshot> Data, ksize_t Size) noexcept : Data_(std::move(Data)), Size_(Size) {}
+		};
+
+		// ͈̗͂vf̐@
+		struct T_UniqueImageGet {
+			[[nodiscard]] static T_ImageView Get(const T_SFFBinaryData& Data, ksize_t index) noexcept { return T_ImageView(Data, index); }
+		};
+
+		struct T_PaletteGet {
+			[[nodiscard]] static const unsigned char* Get(const T_SFFBinaryData& Data, ksize_t index) noexcept { return Data.Palette(index); }
+		};
+
+		// C
+		// ǂݍ񂾃f[^̓XibvVbgƂċLAǂݍ݁Eēǂݍ݁Eł̓|C^݂̂ւ
+		struct T_SFFData {
+		private:
+			std::shared_ptr<const T_SFFSnapshot> Snapshot_ = EmptySnapshot();
+			std::shared_ptr<T_AsyncLoadState> AsyncLoadState_ = {};
+			std::shared_ptr<T_SFFSnapshot> AsyncLoadData_ = {}; // 񓯊ǂݍ݂̓ǂݍݐ(ǂ݂̑ΏۂɎgp)
+			std::pmr::memory_resource* MemoryResource_ = std::pmr::get_default_resource(); // ǂݍSFFf[^̊i[
+			T_LoadFilter LoadFilter_ = {}; // ǂݍމ摜̑Iʏ
+
+			[[nodiscard]] static const std::shared_ptr<const T_SFFSnapshot>& EmptySnapshot() {
+				static const std::shared_ptr<const T_SFFSnapshot> kEmptySnapshot = std::make_shared<const T_SFFSnapshot>();
+				return kEmptySnapshot;
+			}
+
+			// XibvVbg{̂ƕ\E摜f[^Epbgf[^MemoryResourcem
+			[[nodiscard]] static std::shared_ptr<T_SFFSnapshot> NewSnapshot(std::pmr::memory_resource* const MemoryResource) {
+				return std::allocate_shared<T_SFFSnapshot>(std::pmr::polymorphic_allocator<T_SFFSnapshot>(MemoryResource), MemoryResource);
+			}
+
+			// ̓Rs[Ɠ\[Xm
+			[[nodiscard]] static std::shared_ptr<T_SFFSnapshot> CopySnapshot(const T_SFFSnapshot& Data) {
+				return std::allocate_shared<T_SFFSnapshot>(std::pmr::polymorphic_allocator<T_SFFSnapshot>(Data.SFFBinaryData.resource()), Data);
+			}
+
+			// ̃XbhւłQƂł悤Ag~bNɎ擾Eւs
+			[[nodiscard]] std::shared_ptr<const T_SFFSnapshot> Snapshot() const noexcept { return std::atomic_load(&Snapshot_); }
+			void Snapshot(std::shared_ptr<const T_SFFSnapshot> value) noexcept { std::atomic_store(&Snapshot_, std::move(value)); }
+
+			// 񓯊ǂݍݒ̃f[^݂I܂őҋ@
+			void WaitAsyncLoad(bool Cancel) {
+				if (!AsyncLoadState_) { return; }
+				if (Cancel) { AsyncLoadState_->Progress().Cancel(); }
+				AsyncLoadState_->WaitLoadEnd();
+				AsyncLoadState_.reset();
+				AsyncLoadData_.reset();
+			}
+
+			// ĂȂO[v̉摜QƂ摜f[^߂(dŋLꂽ摜f[^͎Qƌ1łcĂΕKv)
+			[[nodiscard]] static std::vector<bool> RequiredSprite(const T_SFFBinaryData& SFFBinaryData, const std::vector<int32_t>& EvictedGroupList) {
+				std::vector<bool> Required(SFFBinaryData.NumSprite(), false);
+				for (const auto& DataList : SFFBinaryData.DataList()) {
+					if (std::binary_search(EvictedGroupList.begin(), EvictedGroupList.end(), DataList.GroupNo())) { continue; }
+					Required[SFFBinaryData.IndexList(DataList.IndexListNumber()).SpriteListIndex()] = true;
+				}
+				return Required;
+			}
+
+			// QƉ\ȃf[^Xg(Xg[~Oǂݍݒ͌Jς݂̐)
+			[[nodiscard]] ksize_t NumAvailableData(const T_SFFSnapshot& Data) const noexcept {
+				if (!IsLoading()) { return static_cast<ksize_t>(Data.SFFBinaryData.DataList().size()); }
+				return (AsyncLoadState_->Streaming() ? AsyncLoadState_->NumPublishedData() : 0);
+			}
+
+			// 摜ԍf[^Xg̃CfbNX
+			[[nodiscard]] int32_t FindSpriteNumber(const T_SFFSnapshot& Data, int32_t GroupNo, int32_t ImageNo) const {
+				if (!IsLoading()) { return Data.SpriteNumberUMap.find(GroupNo, ImageNo); }
+				return Data.SFFBinaryData.FindDataList(GroupNo, ImageNo, 0, NumAvailableData(Data));
+			}
+
+			// ǂݍ(sǂݍݓr̃f[^֓ւ)
+			bool LoadSFFFile(const std::string& FileName, const std::string& FilePath) {
+				std::shared_ptr<T_SFFSnapshot> LoadData = NewSnapshot(MemoryResource_);
+				LoadData->LoadFilter = LoadFilter_;
+				const bool Result = LoadData->LoadSFFFile(FileName, FilePath);
+				Snapshot(std::move(LoadData));
+				return Result;
+			}
+
+			// oCif[^o(dȂ)
+			// PaletteNo̒l̏ꍇ͉摜g̃pbggp
+			[[nodiscard]] static bool WriteBMPFile(const T_SFFBinaryData& SFFBinaryData, ksize_t index, const std::filesystem::path& FullPath, int32_t PaletteNo, std::pmr::memory_resource* const ScratchResource) {
+				// SFF̃oCiBMPtH[}bg֑gݗ
+				const unsigned char* const PaletteBinary = (PaletteNo < 0 ? SFFBinaryData.IndexList_Palette(index) : SFFBinaryData.Palette(PaletteNo));
+				T_BuildBMPBinary BMPBinary(SFFBinaryData.IndexList_Sprite(index), PaletteBinary, SFFBinaryData.IndexList_SpriteSize(index), SFFBinaryData.IndexList_SpriteVerified(index), nullptr, nullptr, ScratchResource);
+				std::ofstream File(FullPath, std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateBMPFileFailed);
+				}
+
+				File.write(reinterpret_cast<const char*>(BMPBinary.data()), BMPBinary.size());
+				File.flush();
+
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteBMPFileFailed);
+				}
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CloseBMPFileFailed);
+				}
+
+				return File.good();
+			}
+
+			// XvCgXgo(dL)
+			// PaletteNo̒l̏ꍇ͉摜g̃pbggp
+			[[nodiscard]] static bool WriteBMPFile(const T_SFFBinaryData& SFFBinaryData, ksize_t index, const std::filesystem::path& FullPath, bool DuplicationSprite, int32_t PaletteNo, std::pmr::memory_resource* const ScratchResource) {
+				// SFF̃oCiBMPtH[}bg֑gݗ
+				const unsigned char* const PaletteBinary = (PaletteNo < 0 ? SFFBinaryData.DataList_Palette(index) : SFFBinaryData.Palette(PaletteNo));
+				T_BuildBMPBinary BMPBinary(SFFBinaryData.DataList_Sprite(index), PaletteBinary, SFFBinaryData.DataList_SpriteSize(index), SFFBinaryData.DataList_SpriteVerified(index), nullptr, nullptr, ScratchResource);
+				std::ofstream File(FullPath, std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateBMPFileFailed);
+				}
+
+				File.write(reinterpret_cast<const char*>(BMPBinary.data()), BMPBinary.size());
+				File.flush();
+
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteBMPFileFailed);
+				}
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CloseBMPFileFailed);
+				}
+
+				return File.good();
+			}
+
+			// ꗗ摜̏o
+			[[nodiscard]] static bool WriteContactSheetFile(const T_BuildContactSheet& ContactSheet, const std::filesystem::path& FullPath) {
+				std::ofstream File(FullPath, std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateBMPFileFailed);
+				}
+
+				File.write(reinterpret_cast<const char*>(ContactSheet.data()), ContactSheet.size());
+				File.flush();
+
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteBMPFileFailed);
+				}
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CloseBMPFileFailed);
+				}
+
+				return File.good();
+			}
+
+			// t@C̏o͐(SFFConfig::SetSAELibPath̐ݒɏ)擾AKvȂtH_쐬
+			[[nodiscard]] static bool ExportDirectoryPath(std::filesystem::path& Path) {
+				T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSffFileFormat::kSystemDirectoryName : ""));
+				if (SAELibFile.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::SAELibFolderInvalidPath);
+					return false;
+				}
+				if (T_Config::Instance().CreateSAELibFile()) {
+					SAELibFile.CreateDirectory(SAELibFile.Path());
+					if (SAELibFile.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSAELibFolderFailed);
+						return false;
+					}
+				}
+				Path = SAELibFile.Path();
+				return true;
+			}
+
+			// O[vԍƂ̃f[^Xg̃CfbNX(O[v̕т͏o)
+			[[nodiscard]] static std::vector<std::pair<int32_t, std::vector<ksize_t>>> GroupDataListIndex(const T_SFFBinaryData& SFFBinaryData) {
+				std::vector<std::pair<int32_t, std::vector<ksize_t>>> GroupList = {};
+				std::unordered_map<int32_t, size_t> GroupPosition = {};
+				for (ksize_t index = 0; index < SFFBinaryData.DataList().size(); ++index) {
+					const int32_t GroupNo = SFFBinaryData.DataList(index).GroupNo();
+					const auto it = GroupPosition.emplace(GroupNo, GroupList.size()).first;
+					if (it->second == GroupList.size()) { GroupList.emplace_back(GroupNo, std::vector<ksize_t>{}); }
+					GroupList[it->second].second.push_back(index);
+				}
+				return GroupList;
+			}
+
+			[[nodiscard]] static std::vector<ksize_t> AllDataListIndex(const T_SFFBinaryData& SFFBinaryData) {
+				std::vector<ksize_t> DataListIndex(SFFBinaryData.DataList().size());
+				for (ksize_t index = 0; index < DataListIndex.size(); ++index) { DataListIndex[index] = index; }
+				return DataListIndex;
+			}
+
+			// ǂݍݍς݂SFFf[^̈ꗗ摜t@C֏o
+			[[nodiscard]] static bool WriteContactSheet(const T_SFFBinaryData& SFFBinaryData, const std::filesystem::path& ExportPath, const std::string& SheetName, int32_t ThumbnailSize, int32_t Columns, bool BoxFilter, bool PerGroup, bool Parallel) {
+				if (!PerGroup) {
+					return WriteContactSheetFile(T_BuildContactSheet(SFFBinaryData, AllDataListIndex(SFFBinaryData), ThumbnailSize, Columns, BoxFilter, Parallel), ExportPath / (SheetName + ".bmp"));
+				}
+
+				T_FilePathSystem ExportDirectory(ExportPath);
+				ExportDirectory.CreateDirectory(ExportPath / SheetName);
+				if (ExportDirectory.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateExportBMPFolderFailed);
+					return false;
+				}
+				for (const auto& Group : GroupDataListIndex(SFFBinaryData)) {
+					const std::string FileName = "Group_" + std::to_string(Group.first) + ".bmp";
+					if (!WriteContactSheetFile(T_BuildContactSheet(SFFBinaryData, Group.second, ThumbnailSize, Columns, BoxFilter, Parallel), ExportPath / SheetName / FileName)) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			// [U[T_DataListANZXi
+			// 擾̃XibvVbgێ邽߁ASFFf[^̓ǂݍ݁EEǰQƂł
+			struct T_AccessData {
+			private:
+				const std::shared_ptr<const T_SFFBinaryData> kSFFBinaryDataPtr; // _~[f[^̏ꍇ͋
+				const ksize_t kDataListIndex; // zIndex(ől̂Ƃ_~[f[^tOƂĎgp)
+
+				const auto& ParamRef() const noexcept { return kSFFBinaryDataPtr->DataList(kDataListIndex); }
+
+				// ǂݍς݂̉fΕȗč\z
+				std::vector<unsigned char> BuildBMP(const unsigned char* const PaletteBinary, const T_OpaqueRect* const TrimRect, std::pmr::memory_resource* const ScratchResource = nullptr) const {
+					if (!IsDummy() && !IsResident()) { return {}; }
+					const std::shared_ptr<const T_DecodedSprite> Decoded = (IsDummy() ? nullptr : kSFFBinaryDataPtr->IndexList_SpriteDecoded(ParamRef().IndexListNumber()));
+					return T_BuildBMPBinary(PixelBinaryData(), PaletteBinary, static_cast<ksize_t>(PixelBinaryDataByteSize()), IsVerified(), TrimRect, (Decoded ? Decoded->data() : nullptr), ScratchResource).vecdata();
+				}
+
+				inline static constexpr unsigned char kDummyBinaryArray[1] = { 0 };
+				inline static constexpr const unsigned char* kDummyBinaryData = kDummyBinaryArray;
+				inline static constexpr T_OpaqueRect kDummyOpaqueRect = {};
+
+				const T_OpaqueRect& OpaqueRect() const noexcept { return (IsDummy() ? kDummyOpaqueRect : kSFFBinaryDataPtr->IndexList_SpriteOpaqueRect(ParamRef().IndexListNumber())); }
+
+			public:
+				/**
+				* @brief _~[f[^f
+				*
+				* @g_~[f[^ł邩mF܂
+				* 
+				* @SFFConfig::SetThrowError̐ݒ肪OFF̏ꍇɃG[̂߂Ɏgp܂
+				*
+				* @return bool (false = gȃf[^Ftrue = g_~[f[^)
+				*/
+				bool IsDummy() const noexcept { return kDataListIndex == KSIZE_MAX; }
+
+				/**
+				* @brief 摜f[^ǂݍ܂Ă邩擾
+				*
+				* @SFF::Evictŉ摜f[^Ăꍇ false Ԃ܂
+				*
+				* @O[vԍEC[WԍEWEpbgEs̋`͎擾ł܂AsNZf[^Ɋւ֐̓_~[f[^ƓlԂ܂
+				*
+				* @_~[f[^̏ꍇ false Ԃ܂
+				*
+				* @return bool 茋 (false = ς݂܂̓_~[f[^Ftrue = ǂݍݍς)
+				*/
+				bool IsResident() const noexcept { return !IsDummy() && kSFFBinaryDataPtr->IndexList_SpriteResident(ParamRef().IndexListNumber()); }
+
+				/**
+				* @brief WX̎擾
+				*
+				* @SAEŐݒ肵WXԂ܂
+				*
+				* @_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return int32_t AxisX WX
 				*/
 				int32_t AxisX() const noexcept { return (IsDummy() ? 0 : ParamRef().AxisX()); }
 			
@@ -1239,341 +6162,2166 @@ namespace SAELib {
 				*/
 				int32_t GroupNo() const noexcept { return (IsDummy() ? 0 : ParamRef().GroupNo()); }
 
-				/**
-				* @brief C[Wԍ̎擾
-				*
-				* @SAEŐݒ肵C[WԍԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t ImageNo C[Wԍ
-				*/
-				int32_t ImageNo() const noexcept { return (IsDummy() ? 0 : ParamRef().ImageNo()); }
-				
-				/**
-				* @brief sNZf[^̎擾
-				*
-				* @摜̃sNZf[^zԂ܂
-				*
-				* @_~[f[^̏ꍇ DummyBinaryData Ԃ܂
-				* 
-				* @DummyBinaryData ͏ɒ1̔zœe {0} ł
-				*
-				* @return const unsigned char* const PixelBinaryData sNZf[^z
-				* @retval const unsigned char* const DummyBinaryData _~[f[^z
-				*/
-				const unsigned char* const PixelBinaryData() const noexcept { return (IsDummy() ? kDummyBinaryData : kSFFBinaryDataPtr->IndexList_Sprite(ParamRef().IndexListNumber())); }
-				
-				/**
-				* @brief sNZf[^TCY̎擾
-				*
-				* @sNZf[^̃oCgTCYԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return size_t PixelBinaryDataSize sNZf[^oCgTCY
-				*/
-				size_t PixelBinaryDataByteSize() const noexcept { return static_cast<size_t>(IsDummy() ? 0 : kSFFBinaryDataPtr->IndexList_SpriteSize(ParamRef().IndexListNumber())); }
-			
-				/**
-				* @brief pbgf[^̎擾
-				*
-				* @摜̃pbgf[^zԂ܂
-				*
-				* @_~[f[^̏ꍇ DummyBinaryData Ԃ܂
-				* 
-				* @DummyBinaryData ͏ɒ1̔zœe {0} ł
-				*
-				* @return const unsigned char* const PaletteBinaryData pbgf[^z
-				* @retval const unsigned char* const DummyBinaryData _~[f[^z
-				*/
-				const unsigned char* const PaletteBinaryData() const noexcept { return (IsDummy() ? kDummyBinaryData : kSFFBinaryDataPtr->IndexList_Palette(ParamRef().IndexListNumber())); }
-				
-				/**
-				* @brief BMPf[^̎擾
-				*
-				* @摜BMP`ɕϊf[^Ԃ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return std::vector<unsigned char> BuildBMPBinaryData BMPf[^
-				*/
-				std::vector<unsigned char> BuildBMPBinaryData() const { return T_BuildBMPBinary(PixelBinaryData(), PaletteBinaryData(), static_cast<ksize_t>(PixelBinaryDataByteSize())).vecdata(); }
-				
-				/**
-				* @brief 摜̕擾
-				*
-				* @sNZf[^ɋL^Ă摜̕Ԃ܂
-				* 
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return uint16_t Width 摜̕
-				*/
-				uint16_t PixelWidth() const noexcept { return (IsDummy() ? 0 : 1 + DecodeBinary::UInt16LE(&PixelBinaryData()[8])); }
-				
-				/**
-				* @brief 摜̍擾
-				*
-				* @sNZf[^ɋL^Ă摜̍Ԃ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return uint16_t Height 摜̍
-				*/
-				uint16_t PixelHeight() const noexcept { return (IsDummy() ? 0 : 1 + DecodeBinary::UInt16LE(&PixelBinaryData()[10])); }
+				/**
+				* @brief C[Wԍ̎擾
+				*
+				* @SAEŐݒ肵C[WԍԂ܂
+				*
+				* @_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return int32_t ImageNo C[Wԍ
+				*/
+				int32_t ImageNo() const noexcept { return (IsDummy() ? 0 : ParamRef().ImageNo()); }
+				
+				/**
+				* @brief sNZf[^̎擾
+				*
+				* @摜̃sNZf[^zԂ܂
+				*
+				* @_~[f[^܂͉摜f[^Ăꍇ DummyBinaryData Ԃ܂
+				* 
+				* @DummyBinaryData ͏ɒ1̔zœe {0} ł
+				*
+				* @return const unsigned char* const PixelBinaryData sNZf[^z
+				* @retval const unsigned char* const DummyBinaryData _~[f[^z
+				*/
+				const unsigned char* const PixelBinaryData() const noexcept { return (IsResident() ? kSFFBinaryDataPtr->IndexList_Sprite(ParamRef().IndexListNumber()) : kDummyBinaryData); }
+				
+				/**
+				* @brief sNZf[^TCY̎擾
+				*
+				* @sNZf[^̃oCgTCYԂ܂
+				*
+				* @_~[f[^܂͉摜f[^Ăꍇ 0 Ԃ܂
+				*
+				* @return size_t PixelBinaryDataSize sNZf[^oCgTCY
+				*/
+				size_t PixelBinaryDataByteSize() const noexcept { return static_cast<size_t>(IsResident() ? kSFFBinaryDataPtr->IndexList_SpriteSize(ParamRef().IndexListNumber()) : 0); }
+			
+				/**
+				* @brief pbgf[^̎擾
+				*
+				* @摜̃pbgf[^zԂ܂
+				*
+				* @_~[f[^̏ꍇ DummyBinaryData Ԃ܂
+				* 
+				* @DummyBinaryData ͏ɒ1̔zœe {0} ł
+				*
+				* @return const unsigned char* const PaletteBinaryData pbgf[^z
+				* @retval const unsigned char* const DummyBinaryData _~[f[^z
+				*/
+				const unsigned char* const PaletteBinaryData() const noexcept { return (IsDummy() ? kDummyBinaryData : kSFFBinaryDataPtr->IndexList_Palette(ParamRef().IndexListNumber())); }
+
+				/**
+				* @brief pbgԍw肵pbgf[^̎擾
+				*
+				* @摜g̃pbg̑Ɏw肵pbgԍ̃pbgf[^zԂ܂
+				*
+				* @pbgԍ̒l̏ꍇ͉摜g̃pbgf[^zԂ܂
+				*
+				* @pbgԍ݂ȂꍇSFFConfig::SetThrowError̐ݒɏAO𓊂Ȃꍇ͉摜g̃pbgf[^zԂ܂
+				*
+				* @_~[f[^̏ꍇ DummyBinaryData Ԃ܂
+				*
+				* @param int32_t PaletteNo pbgԍ (LoadPalette̖߂l܂PaletteNo)
+				* @return const unsigned char* const PaletteBinaryData pbgf[^z
+				* @retval const unsigned char* const DummyBinaryData _~[f[^z
+				*/
+				const unsigned char* const PaletteBinaryData(int32_t PaletteNo) const {
+					if (IsDummy() || PaletteNo < 0) { return PaletteBinaryData(); }
+					if (static_cast<ksize_t>(PaletteNo) >= kSFFBinaryDataPtr->NumPalette()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::PaletteNumberNotFound, PaletteNo);
+						return PaletteBinaryData();
+					}
+					return kSFFBinaryDataPtr->Palette(PaletteNo);
+				}
+
+				/**
+				* @brief pbgԍ̎擾
+				*
+				* @摜g̃pbg̃pbgԍԂ܂
+				*
+				* @_~[f[^̏ꍇ -1 Ԃ܂
+				*
+				* @return int32_t PaletteNo pbgԍ
+				*/
+				int32_t PaletteNo() const noexcept { return (IsDummy() ? -1 : static_cast<int32_t>(kSFFBinaryDataPtr->IndexList(ParamRef().IndexListNumber()).PaletteIndex())); }
+				
+				/**
+				* @brief BMPf[^̎擾
+				*
+				* @摜BMP`ɕϊf[^Ԃ܂
+				*
+				* @_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return std::vector<unsigned char> BuildBMPBinaryData BMPf[^
+				*/
+				std::vector<unsigned char> BuildBMPBinaryData() const { return BuildBMP(PaletteBinaryData(), nullptr); }
+
+				/**
+				* @brief pbgԍw肵BMPf[^̎擾
+				*
+				* @摜w肵pbgԍ̃pbgBMP`ɕϊf[^Ԃ܂
+				*
+				* @摜𕡐̃pbgŎgpꍇ́Ax\zBMPf[^SFF::ChangeBMPPaletteōւł
+				*
+				* @pbgԍ̈PaletteBinaryData(PaletteNo)Ɠł
+				*
+				* @ScratchResourcew肵ꍇAp̍Ɨ̈̃\[Xmۂ܂(߂lBMPf[^͊܂݂܂)
+				*
+				* @param int32_t PaletteNo pbgԍ (LoadPalette̖߂l܂PaletteNo)
+				* @param std::pmr::memory_resource* ScratchResource p̍Ɨ̈̊mې (ȗ͊̃\[X)
+				* @return std::vector<unsigned char> BuildBMPBinaryData BMPf[^
+				*/
+				std::vector<unsigned char> BuildBMPBinaryData(int32_t PaletteNo, std::pmr::memory_resource* const ScratchResource = nullptr) const { return BuildBMP(PaletteBinaryData(PaletteNo), nullptr, ScratchResource); }
+
+				/**
+				* @brief 摜f[^̌،ʂ̎擾
+				*
+				* @ǂݍݎɃsNZf[^(PCX)̐mFłԂ܂
+				*
+				* @؍ς݂̉摜͋E`FbNȗȏBMP֕ϊ܂
+				*
+				* @_~[f[^̏ꍇ false Ԃ܂
+				*
+				* @return bool ، (false = ؂܂͔jFtrue = ؍ς)
+				*/
+				bool IsVerified() const noexcept { return (IsDummy() ? false : kSFFBinaryDataPtr->IndexList_SpriteVerified(ParamRef().IndexListNumber())); }
+
+				/**
+				* @brief ǂݍς݂擾
+				*
+				* @SFF::Prefetchŉf̕ςł邩Ԃ܂Bǂݍς݂̉摜BMPւ̕ϊɕȗ܂
+				*
+				* @_~[f[^̏ꍇ false Ԃ܂
+				*
+				* @return bool 茋 (false = Ftrue = ǂݍς)
+				*/
+				bool IsWarm() const { return !IsDummy() && kSFFBinaryDataPtr->IndexList_SpriteDecoded(ParamRef().IndexListNumber()) != nullptr; }
+				
+				/**
+				* @brief 摜̕擾
+				*
+				* @sNZf[^ɋL^Ă摜̕Ԃ܂
+				* 
+				* @_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return uint16_t Width 摜̕
+				*/
+				uint16_t PixelWidth() const noexcept { return (IsResident() ? 1 + DecodeBinary::UInt16LE(&PixelBinaryData()[8]) : 0); }
+				
+				/**
+				* @brief 摜̍擾
+				*
+				* @sNZf[^ɋL^Ă摜̍Ԃ܂
+				*
+				* @_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return uint16_t Height 摜̍
+				*/
+				uint16_t PixelHeight() const noexcept { return (IsResident() ? 1 + DecodeBinary::UInt16LE(&PixelBinaryData()[10]) : 0); }
+
+				/**
+				* @brief s̍[̍W擾
+				*
+				* @pbgԍ0(F)ȊỎfSĊ܂ލŏ̋`̍[XWԂ܂
+				*
+				* @`͓ǂݍݎ̉摜f[^̌؂Ɠɋ߂A؂̉摜͉摜Ŝ`Ƃ܂
+				*
+				* @sȉfȂ摜ƃ_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return uint16_t OpaqueX s̍[̍W
+				*/
+				uint16_t OpaqueX() const noexcept { return OpaqueRect().X; }
+
+				/**
+				* @brief s̏[̍W擾
+				*
+				* @pbgԍ0(F)ȊỎfSĊ܂ލŏ̋`̏[YWԂ܂
+				*
+				* @sȉfȂ摜ƃ_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return uint16_t OpaqueY s̏[̍W
+				*/
+				uint16_t OpaqueY() const noexcept { return OpaqueRect().Y; }
+
+				/**
+				* @brief s̕擾
+				*
+				* @pbgԍ0(F)ȊỎfSĊ܂ލŏ̋`̕Ԃ܂
+				*
+				* @sȉfȂ摜ƃ_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return uint16_t OpaqueWidth s̕
+				*/
+				uint16_t OpaqueWidth() const noexcept { return OpaqueRect().Width; }
+
+				/**
+				* @brief s̍擾
+				*
+				* @pbgԍ0(F)ȊỎfSĊ܂ލŏ̋`̍Ԃ܂
+				*
+				* @sȉfȂ摜ƃ_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return uint16_t OpaqueHeight s̍
+				*/
+				uint16_t OpaqueHeight() const noexcept { return OpaqueRect().Height; }
+
+				/**
+				* @brief ŝ݂BMPf[^̎擾
+				*
+				* @摜OpaqueX`OpaqueHeight̋`ɐ؂BMP`ɕϊf[^Ԃ܂
+				*
+				* @`艺̍s͕sȂ߁A]̑摜قǍɕϊ܂
+				*
+				* @؂摜`悷ꍇ͎WOpaqueXEOpaqueYlƂĎgpĂ
+				*
+				* @sȉfȂ摜͕ƍ 0 BMPf[^A_~[f[^̏ꍇ͋̔zԂ܂
+				*
+				* @return std::vector<unsigned char> BuildTrimmedBMPBinaryData BMPf[^
+				*/
+				std::vector<unsigned char> BuildTrimmedBMPBinaryData() const { return BuildTrimmedBMPBinaryData(-1); }
+
+				/**
+				* @brief pbgԍw肵ŝ݂BMPf[^̎擾
+				*
+				* @摜s̋`ɐ؂Aw肵pbgԍ̃pbgBMP`ɕϊf[^Ԃ܂
+				*
+				* @pbgԍ̈PaletteBinaryData(PaletteNo)Ɠł
+				*
+				* @param int32_t PaletteNo pbgԍ (LoadPalette̖߂l܂PaletteNo)
+				* @param std::pmr::memory_resource* ScratchResource p̍Ɨ̈̊mې (ȗ͊̃\[X)
+				* @return std::vector<unsigned char> BuildTrimmedBMPBinaryData BMPf[^
+				*/
+				std::vector<unsigned char> BuildTrimmedBMPBinaryData(int32_t PaletteNo, std::pmr::memory_resource* const ScratchResource = nullptr) const {
+					if (!IsResident()) { return {}; }
+					return BuildBMP(PaletteBinaryData(PaletteNo), &OpaqueRect(), ScratchResource);
+				}
+
+				/**
+				* @brief 32bitJ[ɓWJsNZf[^̎擾
+				*
+				* @摜pbg32bitJ[ɓWJAw肵obt@֏[̍s珑݂܂
+				*
+				* @pbgԍ0͓(A=0)AȊO͕s(A=255)ɂȂ܂
+				*
+				* @ݐɂ DestPitch * PixelHeight() oCgȏ̗̈悪Kvł
+				*
+				* @ǂݍς݂̉摜͕ȗ܂
+				*
+				* @pbgԍ̈PaletteBinaryData(PaletteNo)Ɠł
+				*
+				* @_~[f[^̏ꍇƁADestPitch PixelWidth() * 4 ̏ꍇ͉܂ false Ԃ܂
+				*
+				* @param unsigned char* const Dest ݐ̃obt@
+				* @param size_t DestPitch ݐ1s̃oCg
+				* @param PixelFormat Format sNZ`
+				* @param int32_t PaletteNo pbgԍ (ȗ͉摜g̃pbg)
+				* @param std::pmr::memory_resource* ScratchResource ǂ݂ĂȂ摜̕ɎgƗ̈̊mې (ȗ͊̃\[X)
+				* @return bool ݌ (false = sFtrue = )
+				*/
+				bool ExpandPixelData(unsigned char* const Dest, size_t DestPitch, T_PixelFormat Format, int32_t PaletteNo = -1, std::pmr::memory_resource* const ScratchResource = nullptr) const {
+					if (!IsResident()) { return false; }
+					return T_ImageView(*kSFFBinaryDataPtr, ParamRef().IndexListNumber()).ExpandPixelData(Dest, DestPitch, Format, PaletteBinaryData(PaletteNo), ScratchResource);
+				}
+
+				/**
+				* @brief 蔻p}XN̎擾
+				*
+				* @s(pbgԍ0ȊO)1f1rbgŕ\}XNԂ܂
+				*
+				* @}XN͏̎擾ɐA摜f[^摜ŋL܂
+				*
+				* @_~[f[^̏ꍇ͋̃}XNԂ܂
+				*
+				* @return const CollisionMask& CollisionMask 蔻p}XN
+				*/
+				const T_CollisionMask& GetCollisionMask() const {
+					static const T_CollisionMask kDummyCollisionMask;
+					if (IsDummy()) { return kDummyCollisionMask; }
+					return kSFFBinaryDataPtr->IndexList_SpriteCollisionMask(ParamRef().IndexListNumber());
+				}
+
+				/**
+				* @brief ̉摜Ƃ̏dȂ𔻒
+				*
+				* @Ww肵ʒuɍ킹2̉摜zuꍇɁAsȉf1łdȂ邩𔻒肵܂
+				*
+				* @_~[f[^̏ꍇ false Ԃ܂
+				*
+				* @param int32_t PosX g̎WzuXW
+				* @param int32_t PosY g̎WzuYW
+				* @param const SpriteData& Other 肷鑊̉摜
+				* @param int32_t OtherPosX ̎WzuXW
+				* @param int32_t OtherPosY ̎WzuYW
+				* @return bool 茋 (false = dȂȂFtrue = dȂ肠)
+				*/
+				bool Overlap(int32_t PosX, int32_t PosY, const T_AccessData& Other, int32_t OtherPosX, int32_t OtherPosY) const {
+					if (IsDummy() || Other.IsDummy()) { return false; }
+					const int32_t OffsetX = (OtherPosX - Other.AxisX()) - (PosX - AxisX());
+					const int32_t OffsetY = (OtherPosY - Other.AxisY()) - (PosY - AxisY());
+					return GetCollisionMask().Overlap(Other.GetCollisionMask(), OffsetX, OffsetY);
+				}
+
+				T_AccessData(std::shared_ptr<const T_SFFBinaryData> SFFBinaryDataPtr, const ksize_t DataListIndex) : kSFFBinaryDataPtr(std::move(SFFBinaryDataPtr)), kDataListIndex(DataListIndex) {}
+			};
+
+			// XibvVbg̏LLSpriteData쐬
+			[[nodiscard]] static T_AccessData AccessData(const std::shared_ptr<const T_SFFSnapshot>& Data, ksize_t DataListIndex) {
+				return T_AccessData(std::shared_ptr<const T_SFFBinaryData>(Data, &Data->SFFBinaryData), DataListIndex);
+			}
+
+			[[nodiscard]] static T_AccessData DummyAccessData() {
+				return T_AccessData(nullptr, KSIZE_MAX);
+			}
+
+			// LȂSpriteData쐬(͈̗͂vfpŎQƃJEg𑀍삵Ȃ)
+			struct T_SpriteGet {
+				[[nodiscard]] static T_AccessData Get(const T_SFFBinaryData& Data, ksize_t index) {
+					return T_AccessData(std::shared_ptr<const T_SFFBinaryData>(std::shared_ptr<const T_SFFBinaryData>(), &Data), index);
+				}
+			};
+
+		public:
+			/**
+			* @brief SFFf[^̉摜O[v擾
+			*
+			* @ǂݍSFFf[^̉摜O[vԂ܂
+			*
+			* @return int32_t NumGroup 摜O[v
+			*/
+			int32_t NumGroup() const noexcept { return (IsLoading() ? 0 : Snapshot()->NumGroup); }
+		
+			/**
+			* @brief SFFf[^̉摜擾
+			*
+			* @ǂݍSFFf[^̉摜Ԃ܂
+			*
+			* @Xg[~Oǂݍݒ͓ǂݍݍς݂̉摜Ԃ܂
+			*
+			* @return int32_t NumImage 摜
+			*/
+			int32_t NumImage() const noexcept {
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				return (IsLoading() ? static_cast<int32_t>(NumAvailableData(*Data)) : Data->NumImage);
+			}
+
+			/**
+			* @brief SFFf[^̃pbg擾
+			*
+			* @ǂݍSFFf[^̏dpbgԂ܂
+			*
+			* @LoadPaletteŒǉpbg܂݂܂
+			*
+			* @񓯊ǂݍݒ 0 Ԃ܂
+			*
+			* @return int32_t NumPalette pbg
+			*/
+			int32_t NumPalette() const noexcept { return (IsLoading() ? 0 : static_cast<int32_t>(Snapshot()->SFFBinaryData.NumPalette())); }
+			
+			/**
+			* @brief SFFf[^̃t@C擾
+			*
+			* @ǂݍSFFf[^̊gqt@CԂ܂
+			*
+			* @ԂQƂ݂͌̃XibvVbgێA̍ēǂݍ݁E܂ŗLł
+			*
+			* @return const std::string& FileName t@C
+			*/
+			const std::string& FileName() const noexcept { return (IsLoading() ? EmptySnapshot()->FileName : Snapshot()->FileName); }
+
+			/**
+			* @brief SFFf[^̏
+			*
+			* @ǂݍSFFf[^܂
+			*
+			* @񓯊ǂݍݒ̏ꍇ͓ǂݍ݂𒆒f܂
+			*
+			* @擾ς݂SpriteData͏Õf[^QƂ܂
+			*
+			* @note
+			*/
+			void clear() {
+				WaitAsyncLoad(true);
+				Snapshot(EmptySnapshot());
+			}
+
+			/**
+			* @brief SFFf[^̑݊mF
+			*
+			* @ǂݍSFFf[^̋󂩂𔻒肵܂  
+			*
+			* @񓯊ǂݍݒ̓f[^ƂĈ܂
+			*
+			* @return bool 茋 (false = f[^݁Ftrue = f[^)
+			*/
+			bool empty() const noexcept {
+				if (IsLoading()) { return true; }
+				return Snapshot()->empty();
+			}
+
+			/**
+			* @brief SFFf[^̃f[^TCY擾
+			*
+			* @ǂݍSFFf[^̃f[^TCYԂ܂
+			*
+			* @Evictŉ摜f[^͊܂݂܂
+			*
+			* @return size_t SFFDataSize SFFf[^TCY
+			*/
+			size_t size() const noexcept {
+				return (IsLoading() ? 0 : Snapshot()->SFFBinaryData.size());
+			}
+
+			/**
+			* @brief ǂݍ񂾉摜f[^̌،ʂ擾
+			*
+			* @ǂݍ񂾑SẲ摜f[^(PCX)ǂݍݎ̌؂ʉ߂mF܂
+			*
+			* @؂ʉ߂摜͋E`FbNȗȏBMP֕ϊ܂
+			*
+			* @񓯊ǂݍݒ false Ԃ܂
+			*
+			* @return bool ، (false = j摜Ftrue = SČ؍ς)
+			*/
+			bool Verify() const noexcept {
+				return !IsLoading() && Snapshot()->SFFBinaryData.AllSpriteVerified();
+			}
+
+			/**
+			* @brief 񓯊ǂݍݒmF
+			*
+			* @LoadSFFAsync/LoadSFFStreamɂǂݍ݂ĂȂԂ true Ԃ܂
+			*
+			* @LoadSFFAsync̓ǂݍݒSFFf[^͋ƂĈAǂݍݓr̃f[^QƂ邱Ƃ͂܂
+			*
+			* @LoadSFFStream̓ǂݍݒ͓ǂݍݍς݂̉摜̂ݎQƂł܂
+			*
+			* @return bool 茋 (false = ǂݍݒłȂFtrue = ǂݍݒ)
+			*/
+			bool IsLoading() const noexcept {
+				return AsyncLoadState_ && AsyncLoadState_->Loading();
+			}
+
+			/**
+			* @brief SFFf[^̃gpʂ̓擾
+			*
+			* @f[^\Ƃ̎gpƊmۍς݂̃oCgAdō팸oCgԂ܂
+			*
+			* @size͉摜f[^ƃpbgf[^݂̂łA͌p̃nbVe[u▢gp̗\̈܂݂܂
+			*
+			* @񓯊ǂݍݒ͑S 0 Ԃ܂
+			*
+			* @return MemoryReport gpʂ̓
+			*/
+			T_MemoryReport GetMemoryReport() const {
+				T_MemoryReport Report;
+				if (IsLoading()) { return Report; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				Data->SFFBinaryData.MemoryReport(Report);
+				Report.SpriteNumberMap(Data->SpriteNumberUMap.MemoryUsage());
+				Report.SpriteDataMap(Data->SpriteDataUMap.MemoryUsage());
+				return Report;
+			}
+
+		public:
+			using SpriteData = T_AccessData;
+			using VerifyResult = T_VerifyResult;
+			using MemoryReport = T_MemoryReport;
+			using MemoryUsage = T_MemoryUsage;
+			using CollisionMask = T_CollisionMask;
+			using PixelFormat = T_PixelFormat;
+			using UniqueImage = T_ImageView;
+			using SpriteRange = T_SnapshotRange<T_SpriteGet>;
+			using UniqueImageRange = T_SnapshotRange<T_UniqueImageGet>;
+			using PaletteRange = T_SnapshotRange<T_PaletteGet>;
+			using LoadHandle = T_LoadSFFHandle;
+			using PrefetchHandle = T_PrefetchHandle;
+			using LoadFilter = T_LoadFilter;
+			using LoadCallback = std::function<void(bool)>;
+			using LoadExecutor = std::function<void(std::function<void()>)>;
+			using ReloadCallback = std::function<void(int32_t, int32_t)>;
+#ifdef SAELIB_SFF_SHARED_MEMORY
+			using SharedMemory = T_SharedMemory;
+#endif
+
+			T_SFFData() = default;
+
+			T_SFFData(const std::string& FileName, const std::string& FilePath = "")
+			{
+				LoadSFFFile(FileName, FilePath);
+			}
+
+			explicit T_SFFData(std::pmr::memory_resource* const MemoryResource)
+			{
+				SetMemoryResource(MemoryResource);
+			}
+
+			T_SFFData(const std::string& FileName, const std::string& FilePath, std::pmr::memory_resource* const MemoryResource)
+			{
+				SetMemoryResource(MemoryResource);
+				LoadSFFFile(FileName, FilePath);
+			}
+
+			// ̓XibvVbg̋L̂(񓯊ǂݍݒ̃f[^͕Ȃ)
+			T_SFFData(const T_SFFData& Other) : MemoryResource_(Other.MemoryResource_), LoadFilter_(Other.LoadFilter_) {
+				if (!Other.IsLoading()) { Snapshot_ = Other.Snapshot(); }
+			}
+
+			T_SFFData& operator=(const T_SFFData& Other) {
+				if (this != &Other) {
+					WaitAsyncLoad(true);
+					MemoryResource_ = Other.MemoryResource_;
+					LoadFilter_ = Other.LoadFilter_;
+					Snapshot(Other.IsLoading() ? EmptySnapshot() : Other.Snapshot());
+				}
+				return *this;
+			}
+
+			// ړ̓XibvVbgE񓯊ǂݍ݂̏ԁE\[XEIʏp
+			// ǂݍݏ͈ړ֏ނ߁A񓯊ǂݍݒ͏݂̏I҂Ăp(f͂Ȃ)
+			T_SFFData(T_SFFData&& Other) noexcept : MemoryResource_(Other.MemoryResource_), LoadFilter_(std::move(Other.LoadFilter_)) {
+				if (Other.AsyncLoadState_) { Other.AsyncLoadState_->WaitLoadEnd(); }
+				AsyncLoadState_ = std::move(Other.AsyncLoadState_);
+				AsyncLoadData_ = std::move(Other.AsyncLoadData_);
+				Snapshot_ = Other.Snapshot();
+				Other.Snapshot(EmptySnapshot());
+			}
+
+			T_SFFData& operator=(T_SFFData&& Other) noexcept {
+				if (this != &Other) {
+					WaitAsyncLoad(true);
+					if (Other.AsyncLoadState_) { Other.AsyncLoadState_->WaitLoadEnd(); }
+					MemoryResource_ = Other.MemoryResource_;
+					LoadFilter_ = std::move(Other.LoadFilter_);
+					AsyncLoadState_ = std::move(Other.AsyncLoadState_);
+					AsyncLoadData_ = std::move(Other.AsyncLoadData_);
+					Snapshot(Other.Snapshot());
+					Other.Snapshot(EmptySnapshot());
+				}
+				return *this;
+			}
+
+			~T_SFFData() {
+				WaitAsyncLoad(true);
+			}
+
+			/**
+			* @brief SFFf[^̊i[̃\[Xݒ
+			*
+			* @ȍ~̓ǂݍ(LoadSFFALoadSFFAsyncALoadSFFStreamAReloadSFFAAttachShared)ŁA\E摜f[^Epbgf[^̃\[Xmۂ܂
+			*
+			* @ǂݍݍς݂̃f[^͈ړAɊmی̃\[X֕ԋp܂
+			*
+			* @\[XSFFƁA擾SpriteDataÉ͈EAIR݂ĂKv܂
+			*
+			* @XbhZ[tłȂ\[Xw肷ꍇ́Aǂݍ݂Ɣj𓯂XbhōsĂ
+			*
+			* @摜̕LbV͊̃\[Xmۂ܂
+			*
+			* @param std::pmr::memory_resource* MemoryResource i[̃\[X (nullptr = ̃\[X)
+			*/
+			void SetMemoryResource(std::pmr::memory_resource* const MemoryResource) noexcept {
+				MemoryResource_ = (MemoryResource ? MemoryResource : std::pmr::get_default_resource());
+			}
+
+			/**
+			* @brief SFFf[^̊i[̃\[X擾
+			*
+			* @return std::pmr::memory_resource* MemoryResource i[̃\[X
+			*/
+			std::pmr::memory_resource* MemoryResource() const noexcept { return MemoryResource_; }
+
+			/**
+			* @brief ǂݍމ摜̑Iʏݒ
+			*
+			* @ȍ~̓ǂݍ(LoadSFFALoadSFFAsyncALoadSFFStream)ŁAɍ摜݂̂i[܂
+			*
+			* @ɍȂ摜̓Tuwb_[݂̂QƂA摜f[^͓ǂݍ݂܂
+			*
+			* @ɍ摜N摜⋤LpbgŏỎ摜QƂĂꍇ́AQƐ̉摜f[^Epbgf[^݂̂ǂݍ݂܂
+			*
+			* @ReloadSFF͓ǂݍݎ̏ōēǂݍ݂s܂
+			*
+			* @IʓǂݍݎNumGroup͊i[摜̃O[vԂ܂
+			*
+			* @param const LoadFilter& Filter ǂݍݏ (ȗ͑SẲ摜ǂݍ)
+			*/
+			void SetLoadFilter(const T_LoadFilter& Filter = {}) { LoadFilter_ = Filter; }
+
+			/**
+			* @brief ǂݍމ摜̑Iʏ擾
+			*
+			* @return const LoadFilter& Filter ǂݍݏ
+			*/
+			const T_LoadFilter& GetLoadFilter() const noexcept { return LoadFilter_; }
+
+			/**
+			* @brief w肳ꂽSFFt@Cǂݍ
+			*
+			* @st@CqKwփt@Cēǂݍ݂܂
+			*
+			* @w莞͎w肵Kwt@C܂(SFFConfigD悳܂)
+			*
+			* @sɊ̗vf͏A㏑܂
+			*
+			* @param const std::string& FileName t@C (gq .sff ͏ȗ)
+			* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
+			* @return bool ǂݍ݌ (false = sFtrue = )
+			*/
+			bool LoadSFF(const std::string& FileName, const std::string& FilePath = "") {
+				WaitAsyncLoad(true);
+				return LoadSFFFile(FileName, FilePath);
+			}
+
+			/**
+			* @brief w肳ꂽSFFt@C񓯊œǂݍ
+			*
+			* @LoadSFFƓ菇œǂݍ݂ʃXbhōsAi̎擾ƒf\ȃnhԂ܂
+			*
+			* @sɊ̗vf͏Aǂݍ݊܂SFFf[^͋ƂĈ܂
+			*
+			* @ǂݍݓr̃f[^͕ʂ̗̈ɍ\zAɂ܂Ƃ߂Ĕf܂
+			*
+			* @Executorȗꍇ͓ŃXbh𐶐Ďs܂
+			*
+			* @param const std::string& FileName t@C (gq .sff ͏ȗ)
+			* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
+			* @param LoadCallback Callback R[obN (͓ǂݍ݌ʁAǂݍ݂sXbhŎs)
+			* @param LoadExecutor Executor ǂݍݏs֐ (nꂽKxs邱)
+			* @return LoadHandle 񓯊ǂݍ݃nh
+			*/
+			LoadHandle LoadSFFAsync(const std::string& FileName, const std::string& FilePath = "", LoadCallback Callback = {}, LoadExecutor Executor = {}) {
+				return StartAsyncLoad(FileName, FilePath, Callback, Executor, false);
+			}
+
+			/**
+			* @brief w肳ꂽSFFt@CXg[~Oǂݍ
+			*
+			* @LoadSFFAsyncƓlɕʃXbhœǂݍ݂sAǂݍ݂I摜珇ɎQƉ\ɂ܂
+			*
+			* @ǂݍݒǂݍݍς݂̉摜ɂGetSpriteDataŃANZXłAǂݍ݂̉摜݂͑ȂɂȂ܂
+			*
+			* @ǂݍ݂̉摜҂ꍇWaitSpriteDatagp܂
+			*
+			* @ǂݍ݊܂NumGroup 0AFileName͋ANumImage͓ǂݍݍς݂̉摜ԂABMPo͍͂s܂
+			*
+			* @f܂̓G[ŏIꍇǂݍݍς݂̉摜͕ێ܂
+			*
+			* @param const std::string& FileName t@C (gq .sff ͏ȗ)
+			* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
+			* @param LoadCallback Callback R[obN (͓ǂݍ݌ʁAǂݍ݂sXbhŎs)
+			* @param LoadExecutor Executor ǂݍݏs֐ (nꂽKxs邱)
+			* @return LoadHandle 񓯊ǂݍ݃nh
+			*/
+			LoadHandle LoadSFFStream(const std::string& FileName, const std::string& FilePath = "", LoadCallback Callback = {}, LoadExecutor Executor = {}) {
+				return StartAsyncLoad(FileName, FilePath, Callback, Executor, true);
+			}
+
+			/**
+			* @brief wԍ̃f[^փANZX(ǂݍ݊҂)
+			*
+			* @񓯊ǂݍݒ̏ꍇ͎wԍ̉摜ǂݍ܂邩ǂݍ݂I܂őҋ@܂
+			*
+			* @ǂݍݒłȂꍇGetSpriteDataƓł
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @param int32_t ImageNo C[Wԍ
+			* @retval Ώۂ݂ SpriteData
+			* @retval Ώۂ݂Ȃ SFFConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
+			*/
+			const SpriteData WaitSpriteData(int32_t GroupNo, int32_t ImageNo) {
+				if (const std::shared_ptr<T_AsyncLoadState> State = AsyncLoadState_; State && State->Loading()) {
+					if (!State->Streaming()) {
+						State->WaitLoadEnd();
+					}
+					else {
+						const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+						ksize_t NumSearchedData = 0;
+						for (;;) {
+							const bool Loading = State->Loading(); // JɊmF
+							const ksize_t NumPublishedData = State->NumPublishedData();
+							if (int32_t SpriteNumber = Data->SFFBinaryData.FindDataList(GroupNo, ImageNo, NumSearchedData, NumPublishedData); SpriteNumber >= 0) {
+								return AccessData(Data, SpriteNumber);
+							}
+							if (!Loading) { break; }
+							NumSearchedData = NumPublishedData;
+							State->WaitPublish(NumPublishedData);
+						}
+					}
+				}
+				return GetSpriteData(GroupNo, ImageNo);
+			}
+
+			/**
+			* @brief ǂݍSFFt@C̕ύXēǂݍ
+			*
+			* @O̓ǂݍ݈ȍ~Ƀt@CXVĂ΍ēǂݍ݂AύX̂摜ԍCallback֒ʒm܂
+			*
+			* @t@CXVĂȂꍇ̓t@CXV̊mF݂̂ŏI邽߁At[ĂяoĂ肠܂
+			*
+			* @t@C̈ʒuETCYEeOƓ摜f[^͕ύX̂Ȃ摜ƂāA؂Əd`FbNȗĈp܂
+			*
+			* @WE摜f[^Epbgf[^ECfbNX̂ꂩς摜ƁAǉE폜ꂽ摜ʒm܂
+			*
+			* @ēǂݍ݌̃f[^͕ʂ̗̈ɍ\zAɂ܂Ƃ߂ēւ܂
+			*
+			* @ēǂݍݑOɎ擾SpriteData͍ēǂݍݑÕf[^QƂ邽߁Aʒmꂽ摜͎擾Ă
+			*
+			* @̃XbhSFFf[^摜擾ĂԂҋ@Ɏsł܂
+			*
+			* @ǂݍ݂Ɏsꍇ͓ǂݍݑÕf[^ێ܂
+			*
+			* @param ReloadCallback Callback ύXʒmR[obN (̓O[vԍƃC[WԍAύX̂摜Ƃɍēǂݍ݌Ɏs)
+			* @return bool ēǂݍ݌ (false = s܂͖ǂݍ݁Ftrue = ܂͕ύXȂ)
+			*/
+			bool ReloadSFF(ReloadCallback Callback = {}) {
+				if (IsLoading()) { return false; }
+				const std::shared_ptr<const T_SFFSnapshot> BaseData = Snapshot();
+				if (BaseData->LoadFilePath.empty()) { return false; }
+
+				std::error_code ErrorCode = {};
+				const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(BaseData->LoadFilePath, ErrorCode);
+				if (!ErrorCode && WriteTime == BaseData->LastWriteTime) { return true; }
+
+				std::shared_ptr<T_SFFSnapshot> LoadData = NewSnapshot(MemoryResource_);
+				LoadData->LoadFilter = BaseData->LoadFilter;
+				T_ReloadBaseData ReloadBaseData(BaseData->SFFBinaryData);
+				if (!LoadData->LoadSFFFile(BaseData->LoadFilePath.filename().string(), BaseData->LoadFilePath.parent_path().string(), nullptr, &ReloadBaseData)) { return false; }
+
+				// CfbNXς摜擾ƕʂ̉摜ŵŕύXƂĈ
+				std::vector<int32_t> ChangedSpriteNumber = {};
+				const T_SFFBinaryData& LoadBinaryData = LoadData->SFFBinaryData;
+				for (ksize_t index = 0; index < LoadBinaryData.DataList().size(); ++index) {
+					const int32_t BaseIndex = BaseData->SpriteNumberUMap.find(LoadBinaryData.DataList(index).SpriteNumber());
+					if (BaseIndex < 0 || static_cast<ksize_t>(BaseIndex) != index || !BaseData->SFFBinaryData.EqualDataList(BaseIndex, LoadBinaryData, index)) {
+						ChangedSpriteNumber.emplace_back(LoadBinaryData.DataList(index).SpriteNumber());
+					}
+				}
+				for (const auto& DataList : BaseData->SFFBinaryData.DataList()) {
+					if (!LoadData->SpriteNumberUMap.exist(DataList.SpriteNumber())) {
+						ChangedSpriteNumber.emplace_back(DataList.SpriteNumber());
+					}
+				}
+
+				Snapshot(std::move(LoadData));
+				if (Callback) {
+					for (const int32_t SpriteNumber : ChangedSpriteNumber) {
+						Callback(Convert::DecodeSpriteGroupNo(SpriteNumber), Convert::DecodeSpriteImageNo(SpriteNumber));
+					}
+				}
+				return true;
+			}
+
+			/**
+			* @brief wO[v̉摜f[^
+			*
+			* @w肵O[v̉摜f[^(sNZf[^)Agpʂ炵܂
+			*
+			* @O[vԍEC[WԍEWEpbgȂǂ̕\͎c邽߁AExistSpriteNumberGetSpriteDatał̌E擾͂̂܂܍s܂
+			*
+			* @dő̃O[v̉摜ƋLĂ摜f[^́AĂȂO[vQƂĂԂ͉܂
+			*
+			* @摜SpriteDataIsResident false ƂȂAsNZf[^Ɋւ֐̓_~[f[^ƓlԂ܂
+			*
+			* @摜f[^͓̂܂Ƃ܂PʂŎ߁A܂Ƃ܂Ɏc摜f[^͕ʂ̗̈ֈڂ܂
+			*
+			* @OɎ擾SpriteData͉Õf[^QƂA炪SĔjꂽ_Ńԋp܂
+			*
+			* @摜Reloadœǂݍ݌̃t@Cǂݍݒ܂BLoadSFFEReloadSFFœǂݍݒꍇ͑SẲ摜ǂݍ܂ꂽԂɖ߂܂
+			*
+			* @ǂݍ݌̃t@CȂSFFf[^(AttachSharedŐڑf[^)͉ł܂BSFFBuilderŒǉ摜f[^܂
+			*
+			* @݂ȂO[vԍ͖܂
+			*
+			* @param const std::vector<int32_t>& GroupList O[vԍ̈ꗗ
+			* @return bool  (false = ǂݍ݂܂͓ǂݍ݌̃t@CȂFtrue = )
+			*/
+			bool Evict(const std::vector<int32_t>& GroupList) {
+				if (IsLoading() || empty()) { return false; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				if (Data->LoadFilePath.empty()) { return false; }
+
+				std::vector<int32_t> RequestGroupList = GroupList;
+				std::sort(RequestGroupList.begin(), RequestGroupList.end());
+				std::vector<int32_t> EvictedGroupList = Data->EvictedGroupList;
+				for (const auto& DataList : Data->SFFBinaryData.DataList()) {
+					if (std::binary_search(RequestGroupList.begin(), RequestGroupList.end(), DataList.GroupNo())) { EvictedGroupList.emplace_back(DataList.GroupNo()); }
+				}
+				std::sort(EvictedGroupList.begin(), EvictedGroupList.end());
+				EvictedGroupList.erase(std::unique(EvictedGroupList.begin(), EvictedGroupList.end()), EvictedGroupList.end());
+				if (EvictedGroupList == Data->EvictedGroupList) { return true; }
+
+				std::shared_ptr<T_SFFSnapshot> NewData = CopySnapshot(*Data);
+				NewData->EvictedGroupList = std::move(EvictedGroupList);
+				NewData->SFFBinaryData.EvictSprite(RequiredSprite(NewData->SFFBinaryData, NewData->EvictedGroupList));
+				Snapshot(std::move(NewData));
+				return true;
+			}
+
+			/**
+			* @brief 摜f[^ēǂݍ
+			*
+			* @EvictŉwO[v̉摜f[^Aǂݍ݌̃t@C̊Yʒuǂݍݒ܂
+			*
+			* @ǂݍނ͉̂ꂽ摜f[^݂̂ŁA\̍č\z͍s܂
+			*
+			* @ǂݍ݌̃t@CǂݍݎXVE폜Ăꍇ͓ǂݍ܂Ɏs܂(ReloadSFFŃt@CŜǂݍݒĂ)
+			*
+			* @ǂݍ񂾉摜f[^͌؂At@CTCYȂꍇA،ʁEs̋`ǂݍݎƈقȂꍇs܂
+			*
+			* @ĂȂO[vԍ͖܂
+			*
+			* @param const std::vector<int32_t>& GroupList ēǂݍ݂O[vԍ̈ꗗ
+			* @return bool ēǂݍ݌ (false = sFtrue = ܂͉ς݂̉摜Ȃ)
+			*/
+			bool Reload(const std::vector<int32_t>& GroupList) {
+				if (IsLoading() || empty()) { return false; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				std::vector<int32_t> EvictedGroupList = {};
+				for (const int32_t GroupNo : Data->EvictedGroupList) {
+					if (std::find(GroupList.begin(), GroupList.end(), GroupNo) == GroupList.end()) { EvictedGroupList.emplace_back(GroupNo); }
+				}
+				if (EvictedGroupList.size() == Data->EvictedGroupList.size()) { return true; }
+
+				std::error_code ErrorCode = {};
+				const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(Data->LoadFilePath, ErrorCode);
+				const uint64_t FileSize = (ErrorCode ? 0 : static_cast<uint64_t>(std::filesystem::file_size(Data->LoadFilePath, ErrorCode)));
+				std::ifstream File(Data->LoadFilePath, std::ios::binary);
+				if (ErrorCode || WriteTime != Data->LastWriteTime || !File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::ReloadSpriteFailed);
+					return false;
+				}
+
+				std::shared_ptr<T_SFFSnapshot> NewData = CopySnapshot(*Data);
+				NewData->EvictedGroupList = std::move(EvictedGroupList);
+				const bool Restored = NewData->SFFBinaryData.RestoreSprite(RequiredSprite(NewData->SFFBinaryData, NewData->EvictedGroupList), [&File, FileSize](uint32_t FileOffset, std::vector<unsigned char>& SpriteData) {
+					// 摜f[^̓Tuwb_[ɂAt@CɎ܂ĂKv
+					if (FileOffset < SFFFormat::kFileLength || static_cast<uint64_t>(FileOffset) + SpriteData.size() > FileSize) { return false; }
+					File.seekg(FileOffset);
+					File.read(reinterpret_cast<char*>(SpriteData.data()), static_cast<std::streamsize>(SpriteData.size()));
+					return File.gcount() == static_cast<std::streamsize>(SpriteData.size());
+				});
+				if (!Restored) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::ReloadSpriteFailed);
+					return false;
+				}
+				Snapshot(std::move(NewData));
+				return true;
+			}
+
+			/**
+			* @brief wO[v̉摜f[^ǂݍ܂Ă邩擾
+			*
+			* @w肵O[vEvictŉĂȂԂ܂
+			*
+			* @O[vłÃO[vƋLĂ摜f[^͓ǂݍ܂ꂽ܂܂łB摜Pʂ̏ԂSpriteData::IsResidentŊmFł܂
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @return bool 茋 (false = ς݁Ftrue = )
+			*/
+			bool IsResident(int32_t GroupNo) const {
+				if (IsLoading()) { return true; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				return !std::binary_search(Data->EvictedGroupList.begin(), Data->EvictedGroupList.end(), GroupNo);
+			}
+
+			/**
+			* @brief 摜f[^̃O[vԍ̈ꗗ擾
+			*
+			* @return std::vector<int32_t> GroupList EvictŉO[vԍ̈ꗗ ()
+			*/
+			std::vector<int32_t> GetEvictedGroups() const {
+				if (IsLoading()) { return {}; }
+				return Snapshot()->EvictedGroupList;
+			}
+
+			/**
+			* @brief wO[v̉Ō摜f[^̃oCg擾
+			*
+			* @w肵O[vǉEvictꍇɉ摜f[^̍voCgԂ܂
+			*
+			* @̃O[vƋLĂ摜f[^ƁAς݂̉摜f[^͊܂݂܂
+			*
+			* @sɂǂ̃O[v邩̔fɎgpł܂
+			*
+			* @param const std::vector<int32_t>& GroupList O[vԍ̈ꗗ
+			* @return size_t ByteSize 摜f[^̃oCg
+			*/
+			size_t EvictableByteSize(const std::vector<int32_t>& GroupList) const {
+				if (IsLoading()) { return 0; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				std::vector<int32_t> EvictedGroupList = Data->EvictedGroupList;
+				EvictedGroupList.insert(EvictedGroupList.end(), GroupList.begin(), GroupList.end());
+				std::sort(EvictedGroupList.begin(), EvictedGroupList.end());
+				const std::vector<bool> Required = RequiredSprite(Data->SFFBinaryData, EvictedGroupList);
+				size_t ByteSize = 0;
+				for (ksize_t index = 0; index < Data->SFFBinaryData.NumSprite(); ++index) {
+					if (!Required[index] && Data->SFFBinaryData.SpriteResident(index) && Data->SFFBinaryData.SpriteList(index).FileOffset()) { ByteSize += Data->SFFBinaryData.SpriteSize(index); }
+				}
+				return ByteSize;
+			}
+
+			/**
+			* @brief wO[v̉摜ǂ
+			*
+			* @w肵O[v̉摜f[^obNOEhŕăLbVÅmFƒf\ȃnhԂ܂
+			*
+			* @ǂݍς݂̉摜BMPւ̕ϊɕȗ܂BΏۂ͌؍ς݂̉摜݂̂ł
+			*
+			* @ǂݒGetSpriteData͑ҋ@ɎsłAǂ݂ςłȂ摜͂̏ŕ܂
+			*
+			* @ǂ݂1Ƃɑ̃Xbh֎s܂BDx̒ႢXbhŎsꍇExecutorw肵Ă
+			*
+			* @񓯊ǂݍݒɎsꍇ͓ǂݍ݂̏I҂Ăǂ݂܂
+			*
+			* @ǂ݂̌ʂ͎sSFFf[^ɕێAǂݍ݁Eēǂݍ݁ESFFf[^ɂ͈p܂
+			*
+			* @Executorȗꍇ͓ŃXbh𐶐Ďs܂
+			*
+			* @param const std::vector<int32_t>& GroupList Ώۂ̃O[vԍ̃Xg
+			* @param LoadCallback Callback R[obN (͐ǂ݌ʁAǂ݂sXbhŎs)
+			* @param LoadExecutor Executor ǂݏs֐ (nꂽKxs邱)
+			* @return PrefetchHandle ǂ݃nh
+			*/
+			PrefetchHandle Prefetch(const std::vector<int32_t>& GroupList, LoadCallback Callback = {}, LoadExecutor Executor = {}) {
+				std::shared_ptr<T_PrefetchState> State = std::make_shared<T_PrefetchState>();
+				const std::shared_ptr<T_AsyncLoadState> LoadState = (IsLoading() ? AsyncLoadState_ : nullptr);
+				std::shared_ptr<const T_SFFSnapshot> Data = (LoadState ? AsyncLoadData_ : Snapshot());
+
+				auto PrefetchTask = [State, LoadState, Data, GroupList, Callback]() {
+					bool Result = false;
+					std::exception_ptr Exception = {};
+					try {
+						if (LoadState) { LoadState->WaitLoadEnd(); }
+						Result = PrefetchGroup(Data->SFFBinaryData, GroupList, *State);
+					}
+					catch (...) {
+						Exception = std::current_exception();
+					}
+					State->LoadEnd();
+
+					if (Callback) {
+						try {
+							Callback(Result);
+						}
+						catch (...) {
+							if (!Exception) { Exception = std::current_exception(); }
+						}
+					}
+					State->Finish(Result, Exception);
+				};
+
+				if (Executor) {
+					Executor(PrefetchTask);
+				}
+				else {
+					std::thread(PrefetchTask).detach();
+				}
+				return PrefetchHandle(State);
+			}
+
+		private:
+			// wO[v̉摜f[^𕜌ăLbV
+			// 摜f[^L摜1x
+			static bool PrefetchGroup(const T_SFFBinaryData& BinaryData, const std::vector<int32_t>& GroupList, T_PrefetchState& State) {
+				std::vector<ksize_t> TargetList = {};
+				std::vector<bool> Selected(BinaryData.NumSprite(), false);
+				for (const auto& DataList : BinaryData.DataList()) {
+					if (std::find(GroupList.begin(), GroupList.end(), DataList.GroupNo()) == GroupList.end()) { continue; }
+					const ksize_t SpriteListIndex = BinaryData.IndexList(DataList.IndexListNumber()).SpriteListIndex();
+					if (Selected[SpriteListIndex] || !BinaryData.SpriteVerified(SpriteListIndex) || !BinaryData.SpriteResident(SpriteListIndex)) { continue; }
+					Selected[SpriteListIndex] = true;
+					TargetList.emplace_back(SpriteListIndex);
+				}
+
+				int32_t NumAlreadyWarm = 0;
+				for (const ksize_t index : TargetList) {
+					if (BinaryData.SpriteDecoded(index)) { ++NumAlreadyWarm; }
+				}
+				State.NumAlreadyWarm(NumAlreadyWarm);
+				State.Progress().NumImage(static_cast<int32_t>(TargetList.size()));
+
+				int32_t NumWarmed = 0;
+				uint64_t DecodedByteSize = 0;
+				for (const ksize_t index : TargetList) {
+					if (State.Progress().Canceled()) { return false; }
+					BinaryData.WarmSprite(index);
+					DecodedByteSize += T_BuildBMPBinary::DecodedSize(BinaryData.Sprite(index));
+					State.Progress().Update(++NumWarmed, DecodedByteSize);
+					std::this_thread::yield(); // Oʂ̏D悷
+				}
+				return true;
+			}
+
+			LoadHandle StartAsyncLoad(const std::string& FileName, const std::string& FilePath, LoadCallback Callback, LoadExecutor Executor, bool Streaming) {
+				clear();
+				std::shared_ptr<T_AsyncLoadState> State = std::make_shared<T_AsyncLoadState>(Streaming);
+				std::shared_ptr<T_SFFSnapshot> LoadData = NewSnapshot(MemoryResource_);
+				LoadData->LoadFilter = LoadFilter_;
+				AsyncLoadState_ = State;
+				AsyncLoadData_ = LoadData;
+				if (Streaming) { Snapshot(LoadData); } // ǂݍݍς݂̉摜QƂł悤ǂݍݐɌJ
+
+				auto LoadTask = [this, State, LoadData, FileName, FilePath, Callback]() {
+					bool Result = false;
+					std::exception_ptr Exception = {};
+					try {
+						Result = LoadData->LoadSFFFile(FileName, FilePath, State.get()) && !State->Progress().Canceled();
+						if (!State->Streaming() && Result) {
+							Snapshot(LoadData);
+						}
+					}
+					catch (...) {
+						Exception = std::current_exception();
+					}
+					if (State->Streaming() && !Result) {
+						LoadData->NumImage = static_cast<int32_t>(LoadData->SpriteNumberUMap.size()); // ǂݍݍς݂̉摜͕ێ
+					}
+					// ȍ~͂SFF֏܂Ȃ
+					State->LoadEnd();
+
+					if (Callback) {
+						try {
+							Callback(Result);
+						}
+						catch (...) {
+							if (!Exception) { Exception = std::current_exception(); }
+						}
+					}
+					State->Finish(Result, Exception);
+				};
+
+				if (Executor) {
+					Executor(LoadTask);
+				}
+				else {
+					std::thread(LoadTask).detach();
+				}
+				return LoadHandle(State);
+			}
+
+		public:
+			/**
+			* @brief wԍ̑݊mF
+			*
+			* @ǂݍSFFf[^Awԍ݂邩mF܂
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @param int32_t ImageNo C[Wԍ
+			* @return bool  (false = ݂Ȃ : true = ݂)
+			*/
+			bool ExistSpriteNumber(int32_t GroupNo, int32_t ImageNo) {
+				return FindSpriteNumber(*Snapshot(), GroupNo, ImageNo) >= 0;
+			}
+
+			/**
+			* @brief wԍ̃f[^փANZX
+			*
+			* @w肵O[vԍƃC[WԍSFFf[^փANZX܂
+			*
+			* @Ώۂ݂ȂꍇSFFConfig::SetThrowError̐ݒɏ܂
+			*
+			* @SpriteData͎擾̃f[^Lĕێ邽߁ASFFf[^̓ǂݍ݁Eēǂݍ݁EEǰgpł܂
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @param int32_t ImageNo C[Wԍ
+			* @retval Ώۂ݂ SpriteData
+			* @retval Ώۂ݂Ȃ SFFConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
+			*/
+			const SpriteData GetSpriteData(int32_t GroupNo, int32_t ImageNo) {
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				if (int32_t SpriteNumber = FindSpriteNumber(*Data, GroupNo, ImageNo); SpriteNumber >= 0) { // SpriteExist(GroupNo, ImageNo)Ɠ`
+					return AccessData(Data, SpriteNumber);
+				}
+				if (!T_Config::Instance().ThrowError()) {
+					return DummyAccessData();
+				}
+				T_ErrorHandle::Instance().ThrowError(ErrorMessage::SpriteNumberNotFound, GroupNo, ImageNo);
+			}
+
+			/**
+			* @brief wCfbNXf[^̑݊mF
+			*
+			* @ǂݍSFFf[^AwCfbNX̃f[^݂邩mF܂
+			*
+			* @param int32_t index f[^zCfbNX
+			* @return bool  (false = ݂Ȃ : true = ݂)
+			*/
+			bool ExistSpriteDataIndex(int32_t SpriteDataIndex) const {
+				return static_cast<ksize_t>(SpriteDataIndex) < NumAvailableData(*Snapshot());
+			}
+
+			/**
+			* @brief wCfbNX̃f[^փANZX
+			*
+			* @SFFf[^֎w肵CfbNXŃANZX܂
+			*
+			* @Ώۂ݂ȂꍇSFFConfig::SetThrowError̐ݒɏ܂
+			*
+			* @param int32_t index f[^zCfbNX
+			* @retval Ώۂ݂ SpriteData
+			* @retval Ώۂ݂Ȃ SFFConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
+			*/
+			const SpriteData GetSpriteDataIndex(int32_t index) const {
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				if (static_cast<ksize_t>(index) < NumAvailableData(*Data)) {
+					return AccessData(Data, index);
+				}
+				if (!T_Config::Instance().ThrowError()) {
+					return DummyAccessData();
+				}
+				T_ErrorHandle::Instance().ThrowError(ErrorMessage::SpriteIndexNotFound, index);
+			}
+
+			/**
+			* @brief wԍ̃f[^̃CfbNX
+			*
+			* @GetSpriteDataIndexŎgpCfbNXԂ܂B摜JԂQƂꍇ͈xăCfbNXŎQƂĂ
+			*
+			* @CfbNXSFFf[^̓ǂݍ݁Eēǂݍ݁Eŕς\܂
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @param int32_t ImageNo C[Wԍ
+			* @return int32_t SpriteDataIndex f[^̃CfbNX (Ȃꍇ -1)
+			*/
+			int32_t FindSpriteDataIndex(int32_t GroupNo, int32_t ImageNo) const {
+				return FindSpriteNumber(*Snapshot(), GroupNo, ImageNo);
+			}
+
+			/**
+			* @brief SẲ摜͈̔͂擾
+			*
+			* @CfbNXɑSẲ摜SpriteDataԂ_ANZX\Ȕ͈͂ł
+			*
+			* @͈͎͂擾̃f[^ێAvfSpriteData͔͈͂̃f[^QƃJEg𑀍삹ɎQƂ܂
+			*
+			* @̂ߔ͈͂̎擾EɊmۂ܂Bvf͎QƂ̂тɐl̂߁ACe[^̋敪͓̓Ce[^(C++20iterator_concept̓_ANZX)ł
+			*
+			* @vfSpriteData͔͈͂jꂽ͎gpł܂B͈͂̊OŕێꍇGetSpriteDataIndexŎ擾Ă
+			*
+			* @񓯊ǂݍݒIsLoading̐ƓQƉ\ȉ摜݂̂܂܂܂
+			*
+			* @return SpriteRange SẲ摜͈̔
+			*/
+			SpriteRange Sprites() const {
+				std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				const ksize_t Size = NumAvailableData(*Data);
+				return SpriteRange(std::move(Data), Size);
+			}
+
+			/**
+			* @brief d摜͈̔͂擾
+			*
+			* @摜f[^ƃpbgf[^̑gݍ킹Ƃ1AUniqueImageԂ_ANZX\Ȕ͈͂ł
+			*
+			* @摜f[^ƃpbg摜(N摜܂)1ɂ܂Ƃ߂邽߁ABMPö͓ꊇ̏dȂ܂
+			*
+			* @vfUniqueImage͔͈͂jꂽ͎gpł܂
+			*
+			* @񓯊ǂݍݒ͈͋̔͂Ԃ܂
+			*
+			* @return UniqueImageRange d摜͈̔
+			*/
+			UniqueImageRange UniqueImages() const {
+				if (IsLoading()) { return UniqueImageRange(); }
+				std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				const ksize_t Size = static_cast<ksize_t>(Data->SFFBinaryData.IndexList().size());
+				return UniqueImageRange(std::move(Data), Size);
+			}
+
+			/**
+			* @brief pbg͈̔͂擾
+			*
+			* @pbgԍ768oCg̃pbgf[^zԂ_ANZX\Ȕ͈͂ł
+			*
+			* @vf̃pbgf[^z͔͈͂jꂽ͎gpł܂
+			*
+			* @񓯊ǂݍݒ͈͋̔͂Ԃ܂
+			*
+			* @return PaletteRange pbg͈̔
+			*/
+			PaletteRange Palettes() const {
+				if (IsLoading()) { return PaletteRange(); }
+				std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				const ksize_t Size = Data->SFFBinaryData.NumPalette();
+				return PaletteRange(std::move(Data), Size);
+			}
+
+			/**
+			* @brief pbgt@C(.act)ǂݍ
+			*
+			* @pbgt@Cǂݍ݁ApbgԍԂ܂
+			*
+			* @ǂݍSFFf[^ɓpbg݂ꍇ͊̃pbgԍԂ܂
+			*
+			* @MUGEÑpbgt@C͐F̕тt̂߁AReverseOrderȗꍇ͋tƂēǂݍ݂܂
+			*
+			* @ǂݍ񂾃pbgSFFf[^̓ǂݍ݁Eēǂݍ݁EŔj܂
+			*
+			* @pbgǉf[^͕Ăւ邽߁AǉOɎ擾SpriteData͎QƂł܂(摜f[^͕܂)
+			*
+			* @param const std::string& FilePath pbgt@C̃pX
+			* @param bool ReverseOrder F̕тt (false = ʏ̏Ftrue = t)
+			* @retval ǂݍݐ int32_t PaletteNo pbgԍ
+			* @retval ǂݍݎs -1
+			*/
+			int32_t LoadPalette(const std::string& FilePath, bool ReverseOrder = true) {
+				if (IsLoading() || empty()) { return -1; }
+
+				std::ifstream File(FilePath, std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::OpenPaletteFileFailed);
+					return -1;
+				}
+				std::array<unsigned char, SFFFormat::kSFFPaletteSize> LoadPaletteData = {};
+				File.read(reinterpret_cast<char*>(LoadPaletteData.data()), LoadPaletteData.size());
+				if (File.gcount() != static_cast<std::streamsize>(LoadPaletteData.size())) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidPaletteFileSize);
+					return -1;
+				}
+
+				// FP(RGB)ŕт𔽓]
+				if (ReverseOrder) {
+					for (ksize_t i = 0, j = SFFFormat::kSFFPaletteSize - 3; i < j; i += 3, j -= 3) {
+						std::swap_ranges(&LoadPaletteData[i], &LoadPaletteData[i] + 3, &LoadPaletteData[j]);
+					}
+				}
+
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				const ksize_t PaletteIndex = Data->SFFBinaryData.FindPalette(LoadPaletteData.data());
+				if (PaletteIndex == Data->SFFBinaryData.NumPalette()) {
+					std::shared_ptr<T_SFFSnapshot> NewData = CopySnapshot(*Data);
+					NewData->SFFBinaryData.AddPalette(LoadPaletteData);
+					Snapshot(std::move(NewData));
+				}
+				return static_cast<int32_t>(PaletteIndex);
+			}
+
+			/**
+			* @brief BMPf[^̃pbgւ
+			*
+			* @SpriteData::BuildBMPBinaryDataō\zBMPf[^̃pbĝ݂w肵pbgԍ̃pbgɏ܂
+			*
+			* @sNZf[^͍̕sȂ߁Apbg̐؂ւ256F݂̏̂ōς݂܂
+			*
+			* @pbgԍ݂ȂꍇSFFConfig::SetThrowError̐ݒɏ܂
+			*
+			* @param std::vector<unsigned char>& BMPBinaryData BMPf[^
+			* @param int32_t PaletteNo pbgԍ (LoadPalette̖߂l܂SpriteData::PaletteNo)
+			* @return bool  (false = sFtrue = )
+			*/
+			bool ChangeBMPPalette(std::vector<unsigned char>& BMPBinaryData, int32_t PaletteNo) const {
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				if (!ExistPaletteNumber(*Data, PaletteNo)) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::PaletteNumberNotFound, PaletteNo);
+					return false;
+				}
+				return T_BuildBMPBinary::ChangePalette(BMPBinaryData, Data->SFFBinaryData.Palette(PaletteNo));
+			}
+
+			/**
+			* @brief pbgԍ̉f32bitJ[ɓWJ
+			*
+			* @1f1oCg̃pbgԍ̔zA768oCgSFFpbg(RGB~256F)32bitJ[ɓWJď݂܂
+			*
+			* @pbgԍ0͓(A=0)AȊO͕s(A=255)ɂȂ܂
+			*
+			* @ݐɂ NumPixel * 4 oCgȏ̗̈悪Kvł
+			*
+			* @AVX2Lȃrhł̓MU[߂8f܂
+			*
+			* @param const unsigned char* const IndexPixel pbgԍ̔z
+			* @param size_t NumPixel f
+			* @param const unsigned char* const PaletteBinary pbgf[^z (SpriteData::PaletteBinaryData)
+			* @param PixelFormat Format sNZ`
+			* @param unsigned char* const Dest ݐ̃obt@
+			*/
+			static void ExpandPalette(const unsigned char* const IndexPixel, size_t NumPixel, const unsigned char* const PaletteBinary, PixelFormat Format, unsigned char* const Dest) noexcept {
+				T_ExpandPalette::T_Table Table;
+				T_ExpandPalette::BuildTable(PaletteBinary, Format, Table);
+				T_ExpandPalette::Expand(IndexPixel, NumPixel, Table, Dest);
+			}
+
+		private:
+			[[nodiscard]] bool ExistPaletteNumber(const T_SFFSnapshot& Data, int32_t PaletteNo) const noexcept {
+				return !IsLoading() && PaletteNo >= 0 && static_cast<ksize_t>(PaletteNo) < Data.SFFBinaryData.NumPalette();
+			}
+
+		public:
+			/**
+			* @brief wԍ̉摜BMPo
+			*
+			* @w肵O[vԍƃC[WԍSFFf[^BMPt@CƂďo͂܂
+			*
+			* @o͐̃t@C SFFConfig::SetSAELibPath ̐ݒɏ܂
+			*
+			* @pbgԍw肵ꍇ͎w肵pbgŏo͂At@C̖Ƀpbgԍt܂
+			*
+			* @Evictŉ摜f[^Ă摜͏o͂ł܂
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @param int32_t ImageNo C[Wԍ
+			* @param int32_t PaletteNo pbgԍ (ȗ͉摜g̃pbg)
+			* @param std::pmr::memory_resource* ScratchResource BMPf[^̍\zɎgƗ̈̊mې (ȗ͊̃\[X)
+			* @return bool o͌ (false = sFtrue = )
+			*/
+			bool ExportToBMP(int32_t GroupNo, int32_t ImageNo, int32_t PaletteNo = -1, std::pmr::memory_resource* const ScratchResource = nullptr) {
+				if (FileName().empty()) { return false; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				if (PaletteNo >= 0 && !ExistPaletteNumber(*Data, PaletteNo)) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::PaletteNumberNotFound, PaletteNo);
+					return false;
+				}
+				if (const int32_t SpriteNumber = FindSpriteNumber(*Data, GroupNo, ImageNo); SpriteNumber >= 0) {
+					if (!Data->SFFBinaryData.DataList_SpriteResident(SpriteNumber)) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::SpriteDataEvicted, GroupNo, ImageNo);
+						return false;
+					}
+					T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSffFileFormat::kSystemDirectoryName : ""));
+					if (SAELibFile.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::SAELibFolderInvalidPath);
+						return false;
+					}
+					if (T_Config::Instance().CreateSAELibFile()) {
+						SAELibFile.CreateDirectory(SAELibFile.Path());
+						if (SAELibFile.ErrorCode()) {
+							T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSAELibFolderFailed);
+							return false;
+						}
+					}
+
+					const std::filesystem::path SaveFileName = "SFF_" + std::to_string(GroupNo) + "-" + std::to_string(ImageNo) + (PaletteNo >= 0 ? "_Pal" + std::to_string(PaletteNo) : "") + ".bmp";
+					return WriteBMPFile(Data->SFFBinaryData, SpriteNumber, SAELibFile.Path() / SaveFileName, true, PaletteNo, ScratchResource);
+				}
+				T_ErrorHandle::Instance().SetError(ErrorMessage::SpriteNumberNotFound, GroupNo, ImageNo);
+				return false;
+			}
+
+			/**
+			* @brief SĂ̊i[摜BMPo
+			*
+			* @ǂݍSFFf[^SĂBMPt@CƂďo͂܂
+			*
+			* @o͐̃t@C SFFConfig::SetSAELibPath ̐ݒɏ܂
+			*
+			* @pbgԍw肵ꍇ͑SẲ摜w肵pbgŏo͂AtH_̖Ƀpbgԍt܂
+			*
+			* @Ɨ͉̈摜ƂɊmہE܂
+			*
+			* @Evictŉ摜f[^Ă摜͏o͂܂
+			*
+			* @param bool DuplicationSprite d摜o͂邩(false = ܂܂ȂFtrue = ܂)
+			* @param int32_t PaletteNo pbgԍ (ȗ͉摜g̃pbg)
+			* @param std::pmr::memory_resource* ScratchResource BMPf[^̍\zɎgƗ̈̊mې (ȗ͊̃\[X)
+			* @return bool o͌ (false = sFtrue = )
+			*/
+			bool ExportToBMP(const bool DuplicationSprite = true, int32_t PaletteNo = -1, std::pmr::memory_resource* const ScratchResource = nullptr) {
+				if (FileName().empty()) { return false; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				const T_SFFBinaryData& SFFBinaryData = Data->SFFBinaryData;
+				if (PaletteNo >= 0 && !ExistPaletteNumber(*Data, PaletteNo)) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::PaletteNumberNotFound, PaletteNo);
+					return false;
+				}
+				T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSffFileFormat::kSystemDirectoryName : ""));
+				if (SAELibFile.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::SAELibFolderInvalidPath);
+					return false;
+				}
+				if (T_Config::Instance().CreateSAELibFile()) {
+					SAELibFile.CreateDirectory(SAELibFile.Path());
+					if (SAELibFile.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSAELibFolderFailed);
+						return false;
+					}
+				}
+
+				const std::string DirectoryName = "ExportToBMP_" + Data->FileName + (DuplicationSprite ? "_DuplicationSprite" : "") + (PaletteNo >= 0 ? "_Pal" + std::to_string(PaletteNo) : "");
+				SAELibFile.CreateDirectory(SAELibFile.Path() / DirectoryName);
+				if (SAELibFile.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateExportBMPFolderFailed);
+					return false;
+				}
+
+				// BMPo
+				std::string FileName = {};
+				if (DuplicationSprite) {
+					for (ksize_t SpriteListNumber = 0; SpriteListNumber < SFFBinaryData.DataList().size(); ++SpriteListNumber) {
+						if (!SFFBinaryData.DataList_SpriteResident(SpriteListNumber)) { continue; }
+						FileName = "SFF_" + std::to_string(SFFBinaryData.DataList(SpriteListNumber).GroupNo()) + "-" + std::to_string(SFFBinaryData.DataList(SpriteListNumber).ImageNo()) + ".bmp";
+						if (!WriteBMPFile(SFFBinaryData, SpriteListNumber, SAELibFile.Path() / DirectoryName / FileName, true, PaletteNo, ScratchResource)) {
+							return false;
+						}
+					}
+				}
+				else {
+					for (ksize_t IndexListNumber = 0; IndexListNumber < SFFBinaryData.IndexList().size(); ++IndexListNumber) {
+						if (!SFFBinaryData.IndexList_SpriteResident(IndexListNumber)) { continue; }
+						FileName = "SFF_No_" + std::to_string(IndexListNumber) + ".bmp";
+						if (!WriteBMPFile(SFFBinaryData, IndexListNumber, SAELibFile.Path() / DirectoryName / FileName, PaletteNo, ScratchResource)) {
+							return false;
+						}
+					}
+				}
+
+				return true;
+			}
 
-				T_AccessData(const T_SFFBinaryData* const SFFBinaryDataPtr, const ksize_t DataListIndex) : kSFFBinaryDataPtr(SFFBinaryDataPtr), kDataListIndex(DataListIndex) {}
-			};
+			/**
+			* @brief ꗗ摜BMPf[^̎擾
+			*
+			* @i[摜̏kłiqɕׂ24bitBMPf[^Ԃ܂
+			*
+			* @e摜͕s̋`cۂ܂܃ZɎ܂悤k(g͂܂)Ag̃pbg̐Fŕ`悵܂
+			*
+			* @摜̕т͊i[ŁAk͕Xbhŕɍs܂
+			*
+			* @񓯊ǂݍݒA摜݂ȂꍇAZ̑傫 0 ȉ̏ꍇ͋̔zԂ܂
+			*
+			* @param int32_t ThumbnailSize Z1ӂ̉f (ȗ64)
+			* @param int32_t Columns ɕׂ摜 (ȗ16)
+			* @param bool BoxFilter k@ (false = ŋߖTFtrue = ͈͓̕) (ȗtrue)
+			* @param int32_t GroupNo Ώۂ̃O[vԍ (ȗ܂͕̒l̏ꍇ͑SẲ摜)
+			* @return std::vector<unsigned char> BuildContactSheetBinaryData BMPf[^
+			*/
+			std::vector<unsigned char> BuildContactSheetBinaryData(int32_t ThumbnailSize = 64, int32_t Columns = 16, bool BoxFilter = true, int32_t GroupNo = -1) const {
+				if (IsLoading()) { return {}; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				const T_SFFBinaryData& SFFBinaryData = Data->SFFBinaryData;
+				std::vector<ksize_t> DataListIndex = {};
+				if (GroupNo < 0) {
+					DataListIndex = AllDataListIndex(SFFBinaryData);
+				}
+				else {
+					for (ksize_t index = 0; index < SFFBinaryData.DataList().size(); ++index) {
+						if (SFFBinaryData.DataList(index).GroupNo() == GroupNo) { DataListIndex.push_back(index); }
+					}
+				}
+				return T_BuildContactSheet(SFFBinaryData, DataListIndex, ThumbnailSize, Columns, BoxFilter, true).vecdata();
+			}
+
+			/**
+			* @brief ꗗ摜BMPo
+			*
+			* @i[摜̏kłiqɕׂꗗ摜BMPt@CƂďo͂܂
+			*
+			* @o͐̃t@C SFFConfig::SetSAELibPath ̐ݒɏAt@C ContactSheet_(t@C).bmp ł
+			*
+			* @O[vƂɏo͂ꍇ ContactSheet_(t@C) tH_ Group_(O[vԍ).bmp Ƃďo͂܂
+			*
+			* @k@BuildContactSheetBinaryDataƓł
+			*
+			* @param int32_t ThumbnailSize Z1ӂ̉f (ȗ64)
+			* @param int32_t Columns ɕׂ摜 (ȗ16)
+			* @param bool BoxFilter k@ (false = ŋߖTFtrue = ͈͓̕) (ȗtrue)
+			* @param bool PerGroup O[vƂɏo͂邩 (false = 1t@Cɂ܂Ƃ߂Ftrue = O[v) (ȗfalse)
+			* @return bool o͌ (false = sFtrue = )
+			*/
+			bool ExportContactSheet(int32_t ThumbnailSize = 64, int32_t Columns = 16, bool BoxFilter = true, bool PerGroup = false) const {
+				if (IsLoading()) { return false; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				if (Data->FileName.empty() || Data->SFFBinaryData.DataList().empty() || ThumbnailSize <= 0) { return false; }
+				std::filesystem::path ExportPath = {};
+				if (!ExportDirectoryPath(ExportPath)) { return false; }
+				return WriteContactSheet(Data->SFFBinaryData, ExportPath, "ContactSheet_" + Data->FileName, ThumbnailSize, Columns, BoxFilter, PerGroup, true);
+			}
+
+			/**
+			* @brief wpXSFFt@C̈ꗗ摜ꊇo
+			*
+			* @w肵t@CA܂̓tH_ȉ̑SĂ.sfft@C(gq̑啶͋ʂȂ)̈ꗗ摜ɏo͂܂
+			*
+			* @t@CPʂŕXbh֕zAet@C̓ǂݍ݂Ək1̃Xbhōs܂
+			*
+			* @o͐̃t@C SFFConfig::SetSAELibPath ̐ݒɏAt@C͎wpX̑΃pX̋؂ _ ɒu ContactSheet_(΃pX).bmp ł
+			*
+			* @ǂݍ݂o͂Ɏst@CSFFConfig::SetThrowError̐ݒɊւ炸O𓊂ɓǂݔ΂܂
+			*
+			* @param const std::string& Path Ώۂ̃t@C܂̓tH_̃pX
+			* @param int32_t ThumbnailSize Z1ӂ̉f (ȗ64)
+			* @param int32_t Columns ɕׂ摜 (ȗ16)
+			* @param bool BoxFilter k@ (false = ŋߖTFtrue = ͈͓̕) (ȗtrue)
+			* @return int32_t NumExported o͂ɐt@C
+			*/
+			static int32_t ExportContactSheet(const std::string& Path, int32_t ThumbnailSize = 64, int32_t Columns = 16, bool BoxFilter = true) {
+				if (ThumbnailSize <= 0) { return 0; }
+				const std::vector<std::filesystem::path> FilePathList = T_SFFFileSearch::Collect(Path);
+				std::filesystem::path RootPath = Path;
+				std::error_code ErrorCode = {};
+				if (std::filesystem::is_regular_file(Path, ErrorCode)) {
+					RootPath = RootPath.parent_path();
+				}
+
+				std::filesystem::path ExportPath = {};
+				if (FilePathList.empty() || !ExportDirectoryPath(ExportPath)) { return 0; }
+
+				std::atomic<int32_t> NumExported = 0;
+				T_ParallelFor::Run(FilePathList.size(), [&](size_t index) {
+					try {
+						const std::filesystem::path& FilePath = FilePathList[index];
+						std::string SheetName = FilePath.lexically_relative(RootPath).replace_extension().generic_string();
+						std::replace(SheetName.begin(), SheetName.end(), '/', '_');
+
+						T_SFFSnapshot SFFData;
+						if (!SFFData.LoadSFFFile(FilePath.filename().string(), FilePath.parent_path().string())) { return; }
+						if (SFFData.SFFBinaryData.DataList().empty()) { return; }
+						if (WriteContactSheet(SFFData.SFFBinaryData, ExportPath, "ContactSheet_" + SheetName, ThumbnailSize, Columns, BoxFilter, false, false)) {
+							++NumExported;
+						}
+					}
+					catch (...) {} // t@CPʂ̎s͌ɂ̂ݔf
+				});
+				return NumExported;
+			}
+
+			/**
+			* @brief SFFt@CƂĕۑ
+			*
+			* @ǂݍSFFf[^SFFv1`̃t@CƂĕۑ܂
+			*
+			* @摜ƃpbg̑gݍ킹̓N摜AỎ摜Ɠpbg͋LpbgƂďo͂邽߁Ãt@C菬Ȃ܂
+			*
+			* @ǂݍݎɏOꂽdԍ̉摜͏o͂܂
+			*
+			* @ꎞt@C֏񂾌ɒu邽߁Aǂݍ݌̃t@C֏㏑ۑł܂
+			*
+			* @Evictŉ摜f[^Ăꍇ͎s܂(ReloadœǂݍݒĂۑĂ)
+			*
+			* @o͂t@CTCYSFFv1̏(4GiB)𒴂ꍇs܂
+			*
+			* @param const std::string& FilePath ۑ̃t@CpX
+			* @return bool ۑ (false = sFtrue = )
+			*/
+			bool Save(const std::string& FilePath) const {
+				if (IsLoading()) { return false; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				if (Data->FileName.empty()) { return false; }
+				if (!Data->SFFBinaryData.AllSpriteResident()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::SpriteDataEvicted);
+					return false;
+				}
+				const T_BuildSFFBinary SFFBinary(Data->SFFBinaryData, Data->NumGroup, Data->SharedPal);
+				if (!SFFBinary.Built()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::SFFFileSizeOver);
+					return false;
+				}
+				const std::filesystem::path SavePath = FilePath;
+				std::filesystem::path TempPath = SavePath;
+				TempPath += ".tmp";
+
+				std::ofstream File(TempPath, std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSFFFileFailed);
+					return false;
+				}
+
+				File.write(reinterpret_cast<const char*>(SFFBinary.data()), SFFBinary.size());
+				File.flush();
+
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteSFFFileFailed);
+				}
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CloseSFFFileFailed);
+				}
+
+				std::error_code ErrorCode = {};
+				if (File.good()) {
+					std::filesystem::rename(TempPath, SavePath, ErrorCode);
+					if (!ErrorCode) { return true; }
+					T_ErrorHandle::Instance().SetError(ErrorMessage::WriteSFFFileFailed);
+				}
+				std::filesystem::remove(TempPath, ErrorCode);
+				return false;
+			}
+
+#ifdef SAELIB_SFF_SHARED_MEMORY
+			/**
+			* @brief SFFf[^𖼑OtL֌J
+			*
+			* @ǂݍSFFf[^̕\Ɖ摜f[^ÃvZXAttachSharedŐڑł閼OtL֏o͂܂
+			*
+			* @L̃f[^̓|C^܂܂ASċL̐擪̈ʒuŎQƂ܂
+			*
+			* @߂lSharedMemoryjƖO폜AVȐڑ͂łȂȂ܂(ڑς݂̃vZX͂̂܂܎QƂł܂)
+			*
+			* @ŐLɑ݂ꍇƁAEvictŉ摜f[^Ăꍇ͎s܂
+			*
+			* @JُIꍇ(POSIX)͖Oc葱邽߁AUnlinkSharedō폜ĂJĂ
+			*
+			* @param const std::string& Name L̖O
+			* @return SharedMemory JL (s valid()  false)
+			*/
+			SharedMemory PublishShared(const std::string& Name) const {
+				T_SharedMemory SharedMemory;
+				if (IsLoading()) { return SharedMemory; }
+				const std::shared_ptr<const T_SFFSnapshot> Data = Snapshot();
+				if (Data->FileName.empty()) { return SharedMemory; }
+				if (!Data->SFFBinaryData.AllSpriteResident()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::SpriteDataEvicted);
+					return SharedMemory;
+				}
+				if (!SharedMemory.Create(Name, T_SharedSFFLayout::Size(Data->SFFBinaryData, Data->FileName))) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSharedMemoryFailed);
+					return SharedMemory;
+				}
+				T_SharedSFFLayout::Write(SharedMemory.data(), Data->SFFBinaryData, Data->NumGroup, Data->NumImage, Data->SharedPal, Data->FileName);
+				return SharedMemory;
+			}
+
+			/**
+			* @brief OtL̖O폜
+			*
+			* @ُIvZXJ܂܎cL̖O폜AOŌJ悤ɂ܂
+			*
+			* @ڑς݂̃vZX͂̂܂܎QƂłASĂ̐ڑꂽ_Ń܂
+			*
+			* @Windowsł͑SĂ̐ڑꂽ_ŖO폜邽߁A true Ԃ܂
+			*
+			* @param const std::string& Name L̖O
+			* @return bool 폜 (false = s܂݂͑ȂFtrue = )
+			*/
+			static bool UnlinkShared(const std::string& Name) {
+				return T_SharedMemory::Unlink(Name);
+			}
+
+			/**
+			* @brief OtLSFFf[^֐ڑ
+			*
+			* @PublishSharedŌJꂽSFFf[^֓ǂݎpŐڑ܂
+			*
+			* @t@C̓ǂݍ݂͍s킸A摜f[^͕ɋL𒼐ڎQƂ܂
+			*
+			* @L̉摜f[^͐ڑɌ؂߁A摜ɉԂ܂
+			*
+			* @Lւ̐ڑ͂SFFf[^Ƃ̕A擾SpriteDataSĔj܂ŕێ܂
+			*
+			* @ڑSFFf[^͓ǂݍ݌̃t@CȂ߁AReloadSFF false Ԃ܂
+			*
+			* @sɊ̗vf͏A㏑܂
+			*
+			* @param const std::string& Name L̖O
+			* @return bool ڑ (false = sFtrue = )
+			*/
+			bool AttachShared(const std::string& Name) {
+				clear();
+				std::shared_ptr<T_SharedMemory> SharedMemory = std::make_shared<T_SharedMemory>();
+				if (!SharedMemory->Open(Name)) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::OpenSharedMemoryFailed);
+					return false;
+				}
+				const T_SharedSFFLayout Layout(SharedMemory->data(), SharedMemory->size());
+				std::shared_ptr<T_SFFSnapshot> Data = NewSnapshot(MemoryResource_);
+				if (!Layout.Attach(Data->SFFBinaryData, SharedMemory)) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidSharedMemory);
+					return false;
+				}
+
+				// p̃nbVe[u͕\̕тč\z
+				Data->SpriteNumberUMap.reserve(static_cast<ksize_t>(Data->SFFBinaryData.DataList().size()));
+				Data->SpriteDataUMap.reserve(static_cast<ksize_t>(Data->SFFBinaryData.IndexList().size()));
+				for (const auto& IndexList : Data->SFFBinaryData.IndexList()) {
+					Data->SpriteDataUMap.Register(IndexList.SpriteListIndex(), IndexList.PaletteIndex());
+				}
+				for (const auto& DataList : Data->SFFBinaryData.DataList()) {
+					Data->SpriteNumberUMap.Register(DataList.SpriteNumber());
+				}
+				Data->NumGroup = Layout.NumGroup();
+				Data->NumImage = Layout.NumImage();
+				Data->SharedPal = Layout.SharedPal();
+				Data->FileName = Layout.FileName();
+				Snapshot(std::move(Data));
+				return true;
+			}
+#endif
+
+			/**
+			* @brief wpXSFFt@Cꊇ
+			*
+			* @w肵t@CA܂̓tH_ȉ̑SĂ.sfft@C(gq̑啶͋ʂȂ)Ɍ؂܂
+			*
+			* @f[^̊i[͍s킸t@C`Ɖ摜f[^(PCX)݂̐̂mF܂
+			*
+			* @ؒɔG[SFFConfig::SetThrowError̐ݒɊւ炸߂lł̂ݒʒm܂
+			*
+			* @param const std::string& Path Ώۂ̃t@C܂̓tH_̃pX
+			* @return std::vector<VerifyResult> t@CƂ̌،
+			*/
+			static std::vector<VerifyResult> Verify(const std::string& Path) {
+				const std::vector<std::filesystem::path> FilePathList = T_SFFFileSearch::Collect(Path);
+
+				std::vector<VerifyResult> ResultList(FilePathList.size());
+				T_ParallelFor::Run(FilePathList.size(), [&](size_t index) {
+					ResultList[index] = T_VerifySFFFile(FilePathList[index]).Result();
+				});
+				return ResultList;
+			}
+		}; // struct T_SFFData
+
+		// AIRt@C̃t[(摜SFFf[^̃CfbNX։ς)
+		struct T_AIRFrame {
+		private:
+			inline static constexpr uint8_t kFlipH = 1 << 0;
+			inline static constexpr uint8_t kFlipV = 1 << 1;
+			inline static constexpr uint8_t kBlank = 1 << 2; // O[vԍ(摜Ȃ)
+
+			int32_t SpriteDataIndex_ = -1;
+			int32_t SpriteNumber_ = 0;	// groupNo(65535) imageNo(65535)
+			int32_t Offset_ = 0;		// offsetXY(-32768`32767)
+			int32_t Time_ = 0;
+			uint8_t Flags_ = 0;
+
+		public:
+			/**
+			* @brief 摜̃CfbNX擾
+			*
+			* @SFF::GetSpriteDataIndexŎgpCfbNXԂ܂
+			*
+			* @return int32_t SpriteDataIndex f[^̃CfbNX (摜ȂA܂SFFf[^ɑ݂Ȃꍇ -1)
+			*/
+			int32_t SpriteDataIndex() const noexcept { return SpriteDataIndex_; }
+
+			/**
+			* @brief 摜̑݊mF
+			*
+			* @return bool 茋 (false = 摜ȂA܂SFFf[^ɑ݂ȂFtrue = ݂)
+			*/
+			bool Exist() const noexcept { return SpriteDataIndex_ >= 0; }
+
+			/**
+			* @brief 摜Ȃ̃t[𔻒
+			*
+			* @O[vԍ̃t[͉摜\Ȃt[ƂĈ܂
+			*
+			* @return bool 茋 (false = 摜Ftrue = 摜Ȃ)
+			*/
+			bool IsBlank() const noexcept { return (Flags_ & kBlank) != 0; }
+
+			/**
+			* @brief O[vԍ擾
+			*
+			* @return int32_t GroupNo O[vԍ (摜Ȃ̃t[ -1)
+			*/
+			int32_t GroupNo() const noexcept { return (IsBlank() ? -1 : Convert::DecodeSpriteGroupNo(SpriteNumber_)); }
+
+			/**
+			* @brief C[Wԍ擾
+			*
+			* @return int32_t ImageNo C[Wԍ
+			*/
+			int32_t ImageNo() const noexcept { return Convert::DecodeSpriteImageNo(SpriteNumber_); }
+
+			/**
+			* @brief ItZbgX擾
+			*
+			* @return int32_t OffsetX ItZbgX
+			*/
+			int32_t OffsetX() const noexcept { return Convert::DecodeSpriteAxisX(Offset_); }
+
+			/**
+			* @brief ItZbgY擾
+			*
+			* @return int32_t OffsetY ItZbgY
+			*/
+			int32_t OffsetY() const noexcept { return Convert::DecodeSpriteAxisY(Offset_); }
+
+			/**
+			* @brief \Ԃ擾
+			*
+			* @return int32_t Time \ (-1 = )
+			*/
+			int32_t Time() const noexcept { return Time_; }
+
+			/**
+			* @brief ]̗L擾
+			*
+			* @return bool 茋 (false = ]ȂFtrue = ])
+			*/
+			bool FlipH() const noexcept { return (Flags_ & kFlipH) != 0; }
+
+			/**
+			* @brief ]̗L擾
+			*
+			* @return bool 茋 (false = ]ȂFtrue = ])
+			*/
+			bool FlipV() const noexcept { return (Flags_ & kFlipV) != 0; }
+
+			void SpriteDataIndex(int32_t value) noexcept { SpriteDataIndex_ = value; }
+
+			T_AIRFrame(int32_t GroupNo, int32_t ImageNo, int32_t OffsetX, int32_t OffsetY, int32_t Time, bool FlipH, bool FlipV) noexcept
+				: SpriteNumber_(Convert::EncodeIntHalf(GroupNo, ImageNo)), Offset_(Convert::EncodeSpriteAxis(OffsetX, OffsetY)), Time_(Time)
+				, Flags_(static_cast<uint8_t>((FlipH ? kFlipH : 0) | (FlipV ? kFlipV : 0) | (GroupNo < 0 ? kBlank : 0))) {
+			}
+		};
+
+		// AIRt@C̃ANV(t[T_AIRDatãt[z̘A͈)
+		struct T_AIRAction {
+		private:
+			int32_t ActionNo_ = 0;
+			uint32_t FirstFrame_ = 0;
+			uint32_t NumFrame_ = 0;
+			int32_t LoopStart_ = 0;
+			int32_t TotalTime_ = 0;
 
 		public:
 			/**
-			* @brief SFFf[^̉摜O[v擾
-			*
-			* @ǂݍSFFf[^̉摜O[vԂ܂
+			* @brief ANVԍ擾
 			*
-			* @return int32_t NumGroup 摜O[v
+			* @return int32_t ActionNo ANVԍ
 			*/
-			int32_t NumGroup() const noexcept { return NumGroup_; }
-		
+			int32_t ActionNo() const noexcept { return ActionNo_; }
+
 			/**
-			* @brief SFFf[^̉摜擾
-			*
-			* @ǂݍSFFf[^̉摜Ԃ܂
+			* @brief 擪t[̃CfbNX擾
 			*
-			* @return int32_t NumImage 摜
+			* @return uint32_t FirstFrame 擪t[̃CfbNX (AIR::GetFrame)
 			*/
-			int32_t NumImage() const noexcept { return NumImage_; }
-			
+			uint32_t FirstFrame() const noexcept { return FirstFrame_; }
+
 			/**
-			* @brief SFFf[^̃t@C擾
-			*
-			* @ǂݍSFFf[^̊gqt@CԂ܂
+			* @brief t[擾
 			*
-			* @return const std::string& FileName t@C
+			* @return uint32_t NumFrame t[
 			*/
-			const std::string& FileName() const noexcept { return FileName_; }
+			uint32_t NumFrame() const noexcept { return NumFrame_; }
 
 			/**
-			* @brief SFFf[^̏
+			* @brief [vJnt[擾
 			*
-			* @ǂݍSFFf[^܂
+			* @Loopstart̎w肪Ȃꍇ͐擪t[烋[v܂
 			*
-			* @note
+			* @return int32_t LoopStart [vJnt[̃ANV̔ԍ
 			*/
-			void clear() {
-				NumGroup(0);
-				NumImage(0);
-				FileName_.clear();
-				SpriteNumberUMap.clear();
-				SpriteDataUMap.clear();
-				SFFBinaryData.clear();
-			}
+			int32_t LoopStart() const noexcept { return LoopStart_; }
 
 			/**
-			* @brief SFFf[^̑݊mF
-			*
-			* @ǂݍSFFf[^̋󂩂𔻒肵܂  
+			* @brief St[̕\Ԃ̍v擾
 			*
-			* @return bool 茋 (false = f[^݁Ftrue = f[^)
+			* @return int32_t TotalTime \Ԃ̍v (-1 = ̃t[܂)
 			*/
-			bool empty() const noexcept {
-				return FileName().empty() && SFFBinaryData.empty() && SpriteNumberUMap.empty() && SpriteDataUMap.empty();
-			}
+			int32_t TotalTime() const noexcept { return TotalTime_; }
+
+			void NumFrame(uint32_t value) noexcept { NumFrame_ = value; }
+			void LoopStart(int32_t value) noexcept { LoopStart_ = value; }
+			void TotalTime(int32_t value) noexcept { TotalTime_ = value; }
+
+			T_AIRAction(int32_t ActionNo, uint32_t FirstFrame) noexcept : ActionNo_(ActionNo), FirstFrame_(FirstFrame) {}
+		};
+
+		// SFFf[^ɑ݂Ȃ摜QƂĂt[
+		struct T_AIRMissingFrame {
+		private:
+			int32_t ActionNo_ = 0;
+			uint32_t FrameIndex_ = 0;
 
+		public:
 			/**
-			* @brief SFFf[^̃f[^TCY擾
+			* @brief ANVԍ擾
 			*
-			* @ǂݍSFFf[^̃f[^TCYԂ܂
+			* @return int32_t ActionNo ANVԍ
+			*/
+			int32_t ActionNo() const noexcept { return ActionNo_; }
+
+			/**
+			* @brief t[̃CfbNX擾
 			*
-			* @return size_t SFFDataSize SFFf[^TCY
+			* @return uint32_t FrameIndex t[̃CfbNX (AIR::GetFrame)
 			*/
-			size_t size() const noexcept {
-				return SFFBinaryData.size();
+			uint32_t FrameIndex() const noexcept { return FrameIndex_; }
+
+			T_AIRMissingFrame(int32_t ActionNo, uint32_t FrameIndex) noexcept : ActionNo_(ActionNo), FrameIndex_(FrameIndex) {}
+		};
+
+		// AIRt@C̃Aj[V(ǂݍݎɊet[̉摜SFFf[^̃CfbNX։)
+		struct T_AIRData {
+		private:
+			std::string FileName_ = {};
+			T_SFFData SFFData_ = {};					// SFFf[^(XibvVbgL)
+			std::vector<T_AIRAction> ActionList_ = {};	// ANVԍ
+			std::vector<T_AIRFrame> FrameList_ = {};	// ANVɘA
+			std::vector<T_AIRMissingFrame> MissingFrameList_ = {};
+
+			[[nodiscard]] static std::string_view Trim(std::string_view Str) noexcept {
+				while (!Str.empty() && (Str.front() == ' ' || Str.front() == '\t')) { Str.remove_prefix(1); }
+				while (!Str.empty() && (Str.back() == ' ' || Str.back() == '\t' || Str.back() == '\r')) { Str.remove_suffix(1); }
+				return Str;
 			}
 
-		public:
-			using SpriteData = T_AccessData;
+			// ̎w蕶Ŏn܂邩(啶ʂȂ)
+			[[nodiscard]] static bool StartsWith(std::string_view Str, std::string_view Lower) noexcept {
+				if (Str.size() < Lower.size()) { return false; }
+				for (size_t index = 0; index < Lower.size(); ++index) {
+					const char c = Str[index];
+					if ((c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c) != Lower[index]) { return false; }
+				}
+				return true;
+			}
 
-			T_SFFData() = default;
+			[[nodiscard]] static bool ParseInt(std::string_view Str, int32_t& Value) noexcept {
+				Str = Trim(Str);
+				if (!Str.empty() && Str.front() == '+') { Str.remove_prefix(1); }
+				const auto Result = std::from_chars(Str.data(), Str.data() + Str.size(), Value);
+				return Result.ec == std::errc() && Result.ptr == Str.data() + Str.size();
+			}
 
-			T_SFFData(const std::string& FileName, const std::string& FilePath = "")
-			{
-				LoadSFFFile(FileName, FilePath);
+			// "[Begin Action ԍ]" ̃ANVԍ擾
+			[[nodiscard]] static bool ParseBeginAction(std::string_view Line, int32_t& ActionNo) noexcept {
+				Line = Trim(Line.substr(1, Line.find(']') - 1));
+				if (!StartsWith(Line, AIRFormat::kBeginAction)) { return false; }
+				return ParseInt(Line.substr(AIRFormat::kBeginAction.size()), ActionNo);
+			}
+
+			// "O[vԍ, C[Wԍ, ItZbgX, ItZbgY, \[, ][, ]]" 
+			[[nodiscard]] static bool ParseFrame(std::string_view Line, std::vector<T_AIRFrame>& FrameList) {
+				int32_t Field[AIRFormat::kNumFrameField] = {};
+				for (int32_t index = 0; index < AIRFormat::kNumFrameField; ++index) {
+					const size_t Comma = Line.find(',');
+					if (Comma == std::string_view::npos && index < AIRFormat::kNumFrameField - 1) { return false; }
+					if (!ParseInt(Line.substr(0, Comma), Field[index])) { return false; }
+					Line = (Comma == std::string_view::npos ? std::string_view() : Line.substr(Comma + 1));
+				}
+				const std::string_view Flip = Trim(Line.substr(0, Line.find(',')));
+				bool FlipH = false;
+				bool FlipV = false;
+				for (const char c : Flip) {
+					FlipH |= (c == 'H' || c == 'h');
+					FlipV |= (c == 'V' || c == 'v');
+				}
+				FrameList.emplace_back(T_AIRFrame(Field[0], Field[1], Field[2], Field[3], Field[4], FlipH, FlipV));
+				return true;
+			}
+
+			// ǂݍݒ̃ANVm(ԍdĂꍇ͐ɒ`ꂽANVgp)
+			void EndAction(T_AIRAction* Action) {
+				if (!Action) { return; }
+				Action->NumFrame(static_cast<uint32_t>(FrameList_.size()) - Action->FirstFrame());
+				if (static_cast<uint32_t>(Action->LoopStart()) >= Action->NumFrame()) { Action->LoopStart(0); }
+				int32_t TotalTime = 0;
+				for (uint32_t index = Action->FirstFrame(); index < FrameList_.size(); ++index) {
+					if (FrameList_[index].Time() < 0) {
+						TotalTime = -1;
+						break;
+					}
+					TotalTime += FrameList_[index].Time();
+				}
+				Action->TotalTime(TotalTime);
+			}
+
+			[[nodiscard]] bool LoadAIRFile(const std::string& FilePath) {
+				std::ifstream File(FilePath, std::ios::binary);
+				if (!File) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::OpenAIRFileFailed);
+					return false;
+				}
+				const std::string Text((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+
+				std::vector<T_AIRAction> ActionList = {};
+				bool Skip = false; // dANṼt[͓ǂݔ΂
+				int32_t LineNo = 0;
+				for (size_t Begin = 0; Begin < Text.size(); ) {
+					const size_t End = (std::min)(Text.find('\n', Begin), Text.size());
+					std::string_view Line(Text.data() + Begin, End - Begin);
+					Begin = End + 1;
+					++LineNo;
+
+					Line = Trim(Line.substr(0, Line.find(AIRFormat::kComment)));
+					if (Line.empty()) { continue; }
+
+					if (Line.front() == '[') {
+						EndAction((ActionList.empty() || Skip ? nullptr : &ActionList.back()));
+						int32_t ActionNo = 0;
+						Skip = !ParseBeginAction(Line, ActionNo);
+						if (Skip) { continue; }
+						if (std::any_of(ActionList.begin(), ActionList.end(), [ActionNo](const T_AIRAction& Action) { return Action.ActionNo() == ActionNo; })) {
+							T_ErrorHandle::Instance().SetError(ErrorMessage::DuplicateActionNumber, ActionNo);
+							Skip = true;
+							continue;
+						}
+						ActionList.emplace_back(T_AIRAction(ActionNo, static_cast<uint32_t>(FrameList_.size())));
+						continue;
+					}
+					if (ActionList.empty() || Skip) { continue; }
+
+					if (StartsWith(Line, AIRFormat::kLoopStart)) {
+						ActionList.back().LoopStart(static_cast<int32_t>(FrameList_.size() - ActionList.back().FirstFrame()));
+						continue;
+					}
+					// 蔻ƕԂ̎w͈Ȃ
+					if (StartsWith(Line, AIRFormat::kClsn) || StartsWith(Line, AIRFormat::kInterpolate)) { continue; }
+
+					if (!ParseFrame(Line, FrameList_)) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidAIRFrame, LineNo);
+					}
+				}
+				EndAction((ActionList.empty() || Skip ? nullptr : &ActionList.back()));
+
+				std::sort(ActionList.begin(), ActionList.end(), [](const T_AIRAction& Left, const T_AIRAction& Right) { return Left.ActionNo() < Right.ActionNo(); });
+				ActionList_ = std::move(ActionList);
+				return true;
 			}
 
+			// et[̉摜SFFf[^̃CfbNX։
+			void ResolveFrame() {
+				MissingFrameList_.clear();
+				for (auto& Frame : FrameList_) {
+					Frame.SpriteDataIndex(Frame.IsBlank() ? -1 : SFFData_.FindSpriteDataIndex(Frame.GroupNo(), Frame.ImageNo()));
+				}
+				for (const auto& Action : ActionList_) {
+					for (uint32_t index = Action.FirstFrame(); index < Action.FirstFrame() + Action.NumFrame(); ++index) {
+						if (!FrameList_[index].IsBlank() && !FrameList_[index].Exist()) {
+							MissingFrameList_.emplace_back(T_AIRMissingFrame(Action.ActionNo(), index));
+						}
+					}
+				}
+			}
+
+		public:
 			/**
-			* @brief w肳ꂽSFFt@Cǂݍ
+			* @brief AIRt@Cǂݍ
 			*
-			* @st@CqKwփt@Cēǂݍ݂܂
+			* @w肵AIRt@Cǂݍ݁Aet[̉摜w肵SFFf[^̃CfbNX։܂
 			*
-			* @w莞͎w肵Kwt@C܂(SFFConfigD悳܂)
+			* @SFFf[^̓XibvVbgLĕێ邽߁Aw肵SFFf[^ēǂݍ݁EjĂAIRf[^͂̂܂܎QƂł܂
+			*
+			* @蔻(Clsn)ƕ(Interpolate)̎w͓ǂݍ݂܂
+			*
+			* @͂łȂt[̍sInvalidAIRFrameAdANVԍDuplicateActionNumberƂĒʒmAɒ`ꂽANVgp܂
 			*
 			* @sɊ̗vf͏A㏑܂
 			*
-			* @param const std::string& FileName t@C (gq .sff ͏ȗ)
-			* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
+			* @param const std::string& FilePath AIRt@C̃pX
+			* @param const SFF& SFFData 摜̉SFFf[^
 			* @return bool ǂݍ݌ (false = sFtrue = )
 			*/
-			bool LoadSFF(const std::string& FileName, const std::string& FilePath = "") {
-				return LoadSFFFile(FileName, FilePath);
+			bool LoadAIR(const std::string& FilePath, const T_SFFData& SFFData) {
+				clear();
+				if (!LoadAIRFile(FilePath)) { return false; }
+				FileName_ = std::filesystem::path(FilePath).stem().string();
+				Bind(SFFData);
+				return true;
 			}
 
 			/**
-			* @brief wԍ̑݊mF
+			* @brief SFFf[^֍ĉ
 			*
-			* @ǂݍSFFf[^Awԍ݂邩mF܂
+			* @et[̉摜w肵SFFf[^̃CfbNX։܂
 			*
-			* @param int32_t GroupNo O[vԍ
-			* @param int32_t ImageNo C[Wԍ
-			* @return bool  (false = ݂Ȃ : true = ݂)
+			* @SFFf[^ēǂݍ݂ꍇ̓CfbNXς\邽߁Aēǂݍ݌SFFf[^w肵ČĂяoĂ
+			*
+			* @param const SFF& SFFData 摜̉SFFf[^
 			*/
-			bool ExistSpriteNumber(int32_t GroupNo, int32_t ImageNo) {
-				return SpriteNumberUMap.exist(GroupNo, ImageNo);
+			void Bind(const T_SFFData& SFFData) {
+				SFFData_ = SFFData;
+				ResolveFrame();
 			}
 
 			/**
-			* @brief wԍ̃f[^փANZX
+			* @brief ǂݍAIRt@C̊gqt@C擾
 			*
-			* @w肵O[vԍƃC[WԍSFFf[^փANZX܂
+			* @return const std::string& FileName t@C
+			*/
+			const std::string& FileName() const noexcept { return FileName_; }
+
+			/**
+			* @brief ANV擾
 			*
-			* @Ώۂ݂ȂꍇSFFConfig::SetThrowError̐ݒɏ܂
+			* @return size_t NumAction ANV
+			*/
+			size_t NumAction() const noexcept { return ActionList_.size(); }
+
+			/**
+			* @brief SANṼt[擾
 			*
-			* @param int32_t GroupNo O[vԍ
-			* @param int32_t ImageNo C[Wԍ
-			* @retval Ώۂ݂ SpriteData
-			* @retval Ώۂ݂Ȃ SFFConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
+			* @return size_t NumFrame t[
 			*/
-			const SpriteData GetSpriteData(int32_t GroupNo, int32_t ImageNo) {
-				if (int32_t SpriteNumber = SpriteNumberUMap.find(GroupNo, ImageNo); SpriteNumber >= 0) { // SpriteExist(GroupNo, ImageNo)Ɠ`
-					return SpriteData(&SFFBinaryData, SpriteNumber);
-				}
-				if (!T_Config::Instance().ThrowError()) {
-					return SpriteData(&SFFBinaryData, KSIZE_MAX);
-				}
-				T_ErrorHandle::Instance().ThrowError(ErrorMessage::SpriteNumberNotFound, GroupNo, ImageNo);
-			}
+			size_t NumFrame() const noexcept { return FrameList_.size(); }
 
 			/**
-			* @brief wCfbNXf[^̑݊mF
+			* @brief ANV擾
 			*
-			* @ǂݍSFFf[^AwCfbNX̃f[^݂邩mF܂
+			* @ANV̓ANVԍɕł܂
 			*
-			* @param int32_t index f[^zCfbNX
-			* @return bool  (false = ݂Ȃ : true = ݂)
+			* @param uint32_t ActionIndex ANṼCfbNX (0 ` NumAction - 1)
+			* @return const AIR::Action& Action ANV
 			*/
-			bool ExistSpriteDataIndex(int32_t SpriteDataIndex) const {
-				return static_cast<ksize_t>(SpriteDataIndex) < SFFBinaryData.DataList().size();
-			}
+			const T_AIRAction& GetAction(uint32_t ActionIndex) const noexcept { return ActionList_[ActionIndex]; }
 
 			/**
-			* @brief wCfbNX̃f[^փANZX
+			* @brief t[擾
 			*
-			* @SFFf[^֎w肵CfbNXŃANZX܂
+			* @ANṼt[ Action.FirstFrame()  Action.NumFrame() Aĕł܂
 			*
-			* @Ώۂ݂ȂꍇSFFConfig::SetThrowError̐ݒɏ܂
+			* @param uint32_t FrameIndex t[̃CfbNX (0 ` NumFrame - 1)
+			* @return const AIR::Frame& Frame t[
+			*/
+			const T_AIRFrame& GetFrame(uint32_t FrameIndex) const noexcept { return FrameList_[FrameIndex]; }
+
+			/**
+			* @brief wԍ̃ANṼCfbNX
 			*
-			* @param int32_t index f[^zCfbNX
-			* @retval Ώۂ݂ SpriteData
-			* @retval Ώۂ݂Ȃ SFFConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
+			* @param int32_t ActionNo ANVԍ
+			* @return int32_t ActionIndex ANṼCfbNX (Ȃꍇ -1)
 			*/
-			const SpriteData GetSpriteDataIndex(int32_t index) const {
-				if (ExistSpriteDataIndex(index)) {
-					return SpriteData(&SFFBinaryData, index);
-				}
-				if (!T_Config::Instance().ThrowError()) {
-					return SpriteData(&SFFBinaryData, KSIZE_MAX);
-				}
-				T_ErrorHandle::Instance().ThrowError(ErrorMessage::SpriteIndexNotFound, index);
+			int32_t FindAction(int32_t ActionNo) const noexcept {
+				const auto it = std::lower_bound(ActionList_.begin(), ActionList_.end(), ActionNo, [](const T_AIRAction& Action, int32_t Number) { return Action.ActionNo() < Number; });
+				return (it != ActionList_.end() && it->ActionNo() == ActionNo ? static_cast<int32_t>(it - ActionList_.begin()) : -1);
 			}
 
 			/**
-			* @brief wԍ̉摜BMPo
+			* @brief t[̉摜f[^փANZX
 			*
-			* @w肵O[vԍƃC[WԍSFFf[^BMPt@CƂďo͂܂
+			* @ς݂̃CfbNXŎQƂ邽ߌ͍s܂
 			*
-			* @o͐̃t@C SFFConfig::SetSAELibPath ̐ݒɏ܂
+			* @摜݂Ȃt[̏ꍇSFFConfig::SetThrowError̐ݒɏ܂
 			*
-			* @param int32_t GroupNo O[vԍ
-			* @param int32_t ImageNo C[Wԍ
-			* @return bool o͌ (false = sFtrue = )
+			* @param const AIR::Frame& Frame t[
+			* @retval 摜݂ SpriteData
+			* @retval 摜݂Ȃ SFFConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
 			*/
-			bool ExportToBMP(int32_t GroupNo, int32_t ImageNo) {
-				if (FileName().empty()) { return false; }
-				if (ExistSpriteNumber(GroupNo, ImageNo)) {
-					T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSffFileFormat::kSystemDirectoryName : ""));
-					if (SAELibFile.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::SAELibFolderInvalidPath);
-						return false;
-					}
-					if (T_Config::Instance().CreateSAELibFile()) {
-						SAELibFile.CreateDirectory(SAELibFile.Path());
-						if (SAELibFile.ErrorCode()) {
-							T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSAELibFolderFailed);
-							return false;
-						}
-					}
-
-					const std::filesystem::path SaveFileName = "SFF_" + std::to_string(GroupNo) + "-" + std::to_string(ImageNo) + ".bmp";
-					return WriteBMPFile(SpriteNumberUMap.find(GroupNo, ImageNo), SAELibFile.Path() / SaveFileName, true);
-				}
-				T_ErrorHandle::Instance().SetError(ErrorMessage::SpriteNumberNotFound, GroupNo, ImageNo);
-				return false;
+			const T_SFFData::SpriteData GetSpriteData(const T_AIRFrame& Frame) const {
+				return SFFData_.GetSpriteDataIndex(Frame.SpriteDataIndex());
 			}
 
 			/**
-			* @brief SĂ̊i[摜BMPo
+			* @brief SFFf[^ɑ݂Ȃ摜QƂĂt[̈ꗗ擾
 			*
-			* @ǂݍSFFf[^SĂBMPt@CƂďo͂܂
+			* @摜Ȃ(O[vԍ)̃t[͊܂݂܂
 			*
-			* @o͐̃t@C SFFConfig::SetSAELibPath ̐ݒɏ܂
+			* @return const std::vector<AIR::MissingFrame>& MissingFrameList t[̈ꗗ (ANVԍ)
+			*/
+			const std::vector<T_AIRMissingFrame>& MissingFrameList() const noexcept { return MissingFrameList_; }
+
+			/**
+			* @brief AIRf[^̏
+			*/
+			void clear() {
+				FileName_.clear();
+				SFFData_.clear();
+				ActionList_.clear();
+				FrameList_.clear();
+				MissingFrameList_.clear();
+			}
+
+			/**
+			* @brief AIRf[^̑݊mF
 			*
-			* @param bool DuplicationSprite d摜o͂邩(false = ܂܂ȂFtrue = ܂)
-			* @return bool o͌ (false = sFtrue = )
+			* @return bool 茋 (false = f[^݁Ftrue = f[^)
 			*/
-			bool ExportToBMP(const bool DuplicationSprite = true) {
-				if (FileName().empty()) { return false; }
-				T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSffFileFormat::kSystemDirectoryName : ""));
-				if (SAELibFile.ErrorCode()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::SAELibFolderInvalidPath);
-					return false;
-				}
-				if (T_Config::Instance().CreateSAELibFile()) {
-					SAELibFile.CreateDirectory(SAELibFile.Path());
-					if (SAELibFile.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSAELibFolderFailed);
-						return false;
-					}
-				}
+			bool empty() const noexcept { return ActionList_.empty(); }
 
-				const std::string DirectoryName = "ExportToBMP_" + FileName() + (DuplicationSprite ? "_DuplicationSprite" : "");
-				SAELibFile.CreateDirectory(SAELibFile.Path() / DirectoryName);
-				if (SAELibFile.ErrorCode()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::CreateExportBMPFolderFailed);
-					return false;
-				}
+		public:
+			using Action = T_AIRAction;
+			using Frame = T_AIRFrame;
+			using MissingFrame = T_AIRMissingFrame;
 
-				// BMPo
-				std::string FileName = {};
-				if (DuplicationSprite) {
-					for (ksize_t SpriteListNumber = 0; SpriteListNumber < SFFBinaryData.DataList().size(); ++SpriteListNumber) {
-						FileName = "SFF_" + std::to_string(SFFBinaryData.DataList(SpriteListNumber).GroupNo()) + "-" + std::to_string(SFFBinaryData.DataList(SpriteListNumber).ImageNo()) + ".bmp";
-						if (!WriteBMPFile(SpriteListNumber, SAELibFile.Path() / DirectoryName / FileName, true)) {
-							return false;
-						}
-					}
-				}
-				else {
-					for (ksize_t IndexListNumber = 0; IndexListNumber < SFFBinaryData.IndexList().size(); ++IndexListNumber) {
-						FileName = "SFF_No_" + std::to_string(IndexListNumber) + ".bmp";
-						if (!WriteBMPFile(IndexListNumber, SAELibFile.Path() / DirectoryName / FileName)) {
-							return false;
-						}
-					}
-				}
+			T_AIRData() = default;
 
-				return true;
+			T_AIRData(const std::string& FilePath, const T_SFFData& SFFData) {
+				LoadAIR(FilePath, SFFData);
 			}
-		}; // struct T_SFFData
+		};
 	} // namespace ReadSffFile_detail
 
 	// gp[U[̖Oݒ
@@ -1585,11 +8333,56 @@ namespace SAELib {
 	*
 	* @- w肵ȂꍇAt@Cǂݍ݂͍s܂
 	*
+	* @- \[Xw肵ꍇASFFf[^̃\[Xmۂ܂(SetMemoryResourceQ)
+	*
 	* @param const std::string& FileName t@C (gq .sff ͏ȗ)
 	* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
+	* @param std::pmr::memory_resource* MemoryResource SFFf[^̊i[ (ȗ͊̃\[X)
 	*/
 	using SFF = ReadSffFile_detail::T_SFFData;
 
+	/**
+	* @brief SFFt@C̉摜ꗗɂNX
+	*
+	* @- Scan֐ŃtH_ȉ̑SĂSFFt@C̃wb_[ƃTuwb_[݂̂ɑ܂
+	*
+	* @- Save/Load֐ŃJ^OۑAScanł͕ύX̂t@Ĉ݂𑖍܂
+	*/
+	using SFFCatalog = ReadSffFile_detail::T_SFFCatalog;
+
+	/**
+	* @brief 2SFFt@C̍擾NX
+	*
+	* @- Compare֐ŗ̃t@C̃Tuwb_[ƃnbVl݂̂rA摜ԍƂ̒ǉE폜EԍύXEWE摜f[^Epbg̕ύXW܂
+	*
+	* @- RXgN^̈w肵ꍇAw肵Compare֐s܂
+	*
+	* @param const std::string& OldFilePath ύXOSFFt@C̃pX
+	* @param const std::string& NewFilePath ύXSFFt@C̃pX
+	*/
+	using SFFDiff = ReadSffFile_detail::T_SFFDiff;
+
+	/**
+	* @brief 8bitBMP/PCXSFFt@C쐬NX
+	*
+	* @- AddImage/AddBMP/AddPCX/AddFolder֐ŉ摜ԍƎWw肵ĉ摜ǉ܂
+	*
+	* @- Save֐őS摜RLEkAf̓N摜Apbg͋LpbgƂSFFv1`ŕۑ܂
+	*/
+	using SFFBuilder = ReadSffFile_detail::T_SFFBuilder;
+
+	/**
+	* @brief AIRt@CNX
+	*
+	* @- ǂݍݎɊet[̉摜SFFf[^̃CfbNX։AĐ͌ȂŃt[zQƂł܂
+	*
+	* @- RXgN^̈w肵ꍇAw肵LoadAIR֐s܂
+	*
+	* @param const std::string& FilePath AIRt@C̃pX
+	* @param const SFF& SFFData 摜̉SFFf[^
+	*/
+	using AIR = ReadSffFile_detail::T_AIRData;
+
 	/**
 	* @brief ReadSffFilẽG[
 	*/
@@ -1655,6 +8448,19 @@ namespace SAELib {
 		* @param const std::string& Path SFFt@Č̃pX
 		*/
 		inline void SetSFFSearchPath(const std::string& Path = "") { ReadSffFile_detail::T_Config::Instance().SFFSearchPath(Path); }
+
+		/**
+		* @brief ̉fɂ摜f[^̏dݒ
+		*
+		* @ǂݍݎ̉摜f[^̏dAt@C̃oCgɉĕ̉fƉ摜TCYłswł܂
+		*
+		* @RLËk@𑜓xȂǂ̃wb_[݂̂قȂ摜1̉摜f[^ƂĊi[܂
+		*
+		* @ǂݍݎɉ摜Ƃ̕KvɂȂ邽߁AǂݍݎԂ܂
+		*
+		* @param bool flag (false = oCĝ݂Ŕ肷Ftrue = ̉fł肷)
+		*/
+		inline void SetDecodedSpriteDedup(bool flag) { ReadSffFile_detail::T_Config::Instance().DecodedSpriteDedup(flag); }
 	
 		///////////////////////////////////////////////////////////////////////////////////////////////////
 		// Getter /////////////////////////////////////////////////////////////////////////////////////////
@@ -1686,6 +8492,15 @@ namespace SAELib {
 		*/
 		inline bool GetCreateSAELibFile() { return ReadSffFile_detail::T_Config::Instance().CreateSAELibFile(); }
 
+		/**
+		* @brief ̉fɂ摜f[^̏dݒ擾
+		*
+		* @Configݒ̉̕fɂ摜f[^̏dݒ擾܂
+		*
+		* @return bool ̉fɂ摜f[^̏dݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetDecodedSpriteDedup() { return ReadSffFile_detail::T_Config::Instance().DecodedSpriteDedup(); }
+
 		/**
 		* @brief Configݒ擾
 		*